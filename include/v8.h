@@ -2010,6 +2010,35 @@ class V8_EXPORT JSON {
   static V8_WARN_UNUSED_RESULT MaybeLocal<String> Stringify(
       Local<Context> context, Local<Value> json_object,
       Local<String> gap = Local<String>());
+
+  /**
+   * Receives the UTF-8 encoded output of StringifyToSink in chunks.
+   */
+  class V8_EXPORT Utf8Sink {
+   public:
+    virtual ~Utf8Sink() = default;
+
+    /**
+     * Called with each chunk of the output, in order. |data| is only valid
+     * for the duration of the call. Must not call into V8.
+     */
+    virtual void Write(const char* data, size_t length) = 0;
+  };
+
+  /**
+   * Like Stringify, but writes the result to |sink| as UTF-8 instead of
+   * creating a string, so that large results can be written to e.g. a socket
+   * buffer without a copy on the V8 heap. Lone surrogates, which can only
+   * come from |gap|, are written as U+FFFD.
+   *
+   * \return True if the result was written, false if |json_object| has no
+   *   JSON representation (e.g. is undefined or a function) and nothing was
+   *   written, or nothing if an exception was thrown. In the last case, part
+   *   of the output may have been written to |sink| already.
+   */
+  static V8_WARN_UNUSED_RESULT Maybe<bool> StringifyToSink(
+      Local<Context> context, Local<Value> json_object, Utf8Sink* sink,
+      Local<String> gap = Local<String>());
 };
 
 /**
@@ -7038,6 +7067,31 @@ class V8_EXPORT HeapCodeStatistics {
   friend class Isolate;
 };
 
+/**
+ * Statistics about code caches consumed by an isolate, and about how many lazy
+ * function compiles could reuse preparse data instead of preparsing the inner
+ * functions again. Preparse data of uncompiled functions is part of the code
+ * cache, so functions compiled lazily after a code cache hit usually find it.
+ */
+class V8_EXPORT CodeCacheStatistics {
+ public:
+  CodeCacheStatistics();
+  size_t code_cache_hits() { return code_cache_hits_; }
+  size_t code_cache_rejects() { return code_cache_rejects_; }
+  size_t lazy_compiles() { return lazy_compiles_; }
+  size_t lazy_compiles_with_preparse_data() {
+    return lazy_compiles_with_preparse_data_;
+  }
+
+ private:
+  size_t code_cache_hits_;
+  size_t code_cache_rejects_;
+  size_t lazy_compiles_;
+  size_t lazy_compiles_with_preparse_data_;
+
+  friend class Isolate;
+};
+
 /**
  * A JIT code event is issued each time code is added, moved or removed.
  *
@@ -7880,6 +7934,32 @@ class V8_EXPORT Isolate {
    */
   bool GetHeapCodeAndMetadataStatistics(HeapCodeStatistics* object_statistics);
 
+  /**
+   * Get statistics about consumed code caches and lazy compiles.
+   *
+   * \param cache_statistics The CodeCacheStatistics object to fill in
+   *   the number of accepted and rejected code caches and the number of lazy
+   *   compiles with and without preparse data since the isolate was created.
+   * \returns true on success.
+   */
+  bool GetCodeCacheStatistics(CodeCacheStatistics* cache_statistics);
+
+  /**
+   * Starts recording the functions that get compiled, e.g. during the startup
+   * of an application. A code cache created later with
+   * ScriptCompiler::CreateCodeCache includes every recorded function of the
+   * script, even if its bytecode has been flushed in the meantime, so that
+   * consuming the cache avoids lazy compiles on the startup path. Starting
+   * again discards the previous recording.
+   */
+  void StartCodeCacheWarmUp();
+
+  /**
+   * Stops recording compiled functions. The functions recorded so far are
+   * still included in code caches created later.
+   */
+  void StopCodeCacheWarmUp();
+
   /**
    * Get a call stack sample from the isolate.
    * \param state Execution state.
@@ -3040,6 +3040,22 @@ MaybeLocal<String> JSON::Stringify(Local<Context> context,
   RETURN_ESCAPED(result);
 }
 
+Maybe<bool> JSON::StringifyToSink(Local<Context> context,
+                                  Local<Value> json_object, Utf8Sink* sink,
+                                  Local<String> gap) {
+  auto isolate = reinterpret_cast<i::Isolate*>(context->GetIsolate());
+  ENTER_V8(isolate, context, JSON, Stringify, Nothing<bool>(), i::HandleScope);
+  i::Handle<i::Object> object = Utils::OpenHandle(*json_object);
+  i::Handle<i::String> gap_string = gap.IsEmpty()
+                                        ? isolate->factory()->empty_string()
+                                        : Utils::OpenHandle(*gap);
+  Maybe<bool> result =
+      i::JsonStringifyToSink(isolate, object, gap_string, sink);
+  has_pending_exception = result.IsNothing();
+  RETURN_ON_FAILED_EXECUTION_PRIMITIVE(bool);
+  return result;
+}
+
 // --- V a l u e   S e r i a l i z a t i o n ---
 
 Maybe<bool> ValueSerializer::Delegate::WriteHostObject(Isolate* v8_isolate,
@@ -5625,6 +5641,12 @@ HeapCodeStatistics::HeapCodeStatistics()
       bytecode_and_metadata_size_(0),
       external_script_source_size_(0) {}
 
+CodeCacheStatistics::CodeCacheStatistics()
+    : code_cache_hits_(0),
+      code_cache_rejects_(0),
+      lazy_compiles_(0),
+      lazy_compiles_with_preparse_data_(0) {}
+
 bool v8::V8::InitializeICU(const char* icu_data_file) {
   return i::InitializeICU(icu_data_file);
 }
@@ -8147,6 +8169,29 @@ bool Isolate::GetHeapCodeAndMetadataStatistics(
   return true;
 }
 
+bool Isolate::GetCodeCacheStatistics(CodeCacheStatistics* cache_statistics) {
+  if (!cache_statistics) return false;
+
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  cache_statistics->code_cache_hits_ = isolate->code_cache_hits();
+  cache_statistics->code_cache_rejects_ = isolate->code_cache_rejects();
+  cache_statistics->lazy_compiles_ = isolate->lazy_compiles();
+  cache_statistics->lazy_compiles_with_preparse_data_ =
+      isolate->lazy_compiles_with_preparse_data();
+  return true;
+}
+
+void Isolate::StartCodeCacheWarmUp() {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  ENTER_V8_NO_SCRIPT_NO_EXCEPTION(isolate);
+  isolate->StartCodeCacheWarmUp();
+}
+
+void Isolate::StopCodeCacheWarmUp() {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  isolate->StopCodeCacheWarmUp();
+}
+
 void Isolate::GetStackSample(const RegisterState& state, void** frames,
                              size_t frames_limit, SampleInfo* sample_info) {
   RegisterState regs = state;
@@ -1026,6 +1026,7 @@ namespace internal {
                                                                                \
   /* Wasm */                                                                   \
   ASM(WasmCompileLazy, Dummy)                                                  \
+  TFC(WasmCompileJSToWasmWrapperLazy, JSTrampoline)                            \
   TFC(WasmAllocateHeapNumber, AllocateHeapNumber)                              \
   TFC(WasmAtomicNotify, WasmAtomicNotify)                                      \
   TFC(WasmI32AtomicWait, WasmI32AtomicWait)                                    \
@@ -161,6 +161,14 @@ TF_BUILTIN(CompileLazy, LazyBuiltinsAssembler) {
   CompileLazy(function);
 }
 
+TF_BUILTIN(WasmCompileJSToWasmWrapperLazy, LazyBuiltinsAssembler) {
+  TNode<JSFunction> function = CAST(Parameter(Descriptor::kTarget));
+
+  // The runtime installs the specialized wrapper on {function}.
+  GenerateTailCallToReturnedCode(Runtime::kWasmCompileJSToWasmWrapper,
+                                 function);
+}
+
 TF_BUILTIN(CompileLazyDeoptimizedCode, LazyBuiltinsAssembler) {
   TNode<JSFunction> function = CAST(Parameter(Descriptor::kTarget));
 
@@ -219,7 +219,7 @@ TNode<JSRegExpResult> RegExpBuiltinsAssembler::ConstructNewResultFromMatchInfo(
     CSA_ASSERT(this, SmiGreaterThan(num_results, SmiConstant(1)));
 
     // We reach this point only if captures exist, implying that this is an
-    // IRREGEXP JSRegExp.
+    // IRREGEXP or EXPERIMENTAL JSRegExp.
 
     TNode<JSRegExp> regexp = CAST(maybe_regexp);
 
@@ -229,8 +229,12 @@ TNode<JSRegExpResult> RegExpBuiltinsAssembler::ConstructNewResultFromMatchInfo(
     TNode<FixedArray> data =
         CAST(LoadObjectField(regexp, JSRegExp::kDataOffset));
     CSA_ASSERT(this,
-               SmiEqual(CAST(LoadFixedArrayElement(data, JSRegExp::kTagIndex)),
-                        SmiConstant(JSRegExp::IRREGEXP)));
+               Word32Or(SmiEqual(CAST(LoadFixedArrayElement(
+                                     data, JSRegExp::kTagIndex)),
+                                 SmiConstant(JSRegExp::IRREGEXP)),
+                        SmiEqual(CAST(LoadFixedArrayElement(
+                                     data, JSRegExp::kTagIndex)),
+                                 SmiConstant(JSRegExp::EXPERIMENTAL))));
 
     // The names fixed array associates names at even indices with a capture
     // index at odd indices.
@@ -374,9 +378,12 @@ TNode<HeapObject> RegExpBuiltinsAssembler::RegExpExecInternal(
           data, IntPtrConstant(JSRegExp::kTagIndex));
 
       int32_t values[] = {
-          JSRegExp::IRREGEXP, JSRegExp::ATOM, JSRegExp::NOT_COMPILED,
+          JSRegExp::IRREGEXP,
+          JSRegExp::ATOM,
+          JSRegExp::NOT_COMPILED,
+          JSRegExp::EXPERIMENTAL,
       };
-      Label* labels[] = {&next, &atom, &runtime};
+      Label* labels[] = {&next, &atom, &runtime, &runtime};
 
       STATIC_ASSERT(arraysize(values) == arraysize(labels));
       Switch(tag, &unreachable, values, labels, arraysize(values));
@@ -396,6 +403,17 @@ TNode<HeapObject> RegExpBuiltinsAssembler::RegExpExecInternal(
     STATIC_ASSERT(kOffsetsSize >= 2);
     GotoIf(SmiAbove(capture_count, SmiConstant(kOffsetsSize / 2 - 1)),
            &runtime);
+
+    // Long subjects are searched for the literal prefix in the runtime.
+    Label no_prefix_scan(this);
+    GotoIf(TaggedIsSmi(UnsafeLoadFixedArrayElement(
+               data, JSRegExp::kIrregexpLiteralPrefixIndex)),
+           &no_prefix_scan);
+    Branch(IntPtrGreaterThanOrEqual(
+               IntPtrSub(int_string_length, int_last_index),
+               IntPtrConstant(RegExp::kPrefixScanMinSubjectLength)),
+           &runtime, &no_prefix_scan);
+    BIND(&no_prefix_scan);
   }
 
   // Ensure that a RegExp stack is allocated. This check is after branching off
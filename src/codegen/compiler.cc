@@ -1308,10 +1308,14 @@ bool Compiler::Compile(Handle<SharedFunctionInfo> shared_info,
     }
     *is_compiled_scope = shared_info->is_compiled_scope();
     DCHECK(is_compiled_scope->is_compiled());
+    isolate->RecordCodeCacheWarmUp(shared_info);
     return true;
   }
 
+  isolate->set_lazy_compiles(isolate->lazy_compiles() + 1);
   if (shared_info->HasUncompiledDataWithPreparseData()) {
+    isolate->set_lazy_compiles_with_preparse_data(
+        isolate->lazy_compiles_with_preparse_data() + 1);
     parse_info.set_consumed_preparse_data(ConsumedPreparseData::For(
         isolate,
         handle(
@@ -1353,6 +1357,7 @@ bool Compiler::Compile(Handle<SharedFunctionInfo> shared_info,
     SharedFunctionInfo::EnsureSourcePositionsAvailable(isolate, shared_info);
   }
 
+  isolate->RecordCodeCacheWarmUp(shared_info);
   return true;
 }
 
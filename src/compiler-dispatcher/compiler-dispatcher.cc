@@ -38,6 +38,7 @@ CompilerDispatcher::CompilerDispatcher(Isolate* isolate, Platform* platform,
       platform_(platform),
       max_stack_size_(max_stack_size),
       trace_compiler_dispatcher_(FLAG_trace_compiler_dispatcher),
+      finalize_in_foreground_tasks_(FLAG_parallel_compile_tasks_for_lazy),
       task_manager_(new CancelableTaskManager()),
       next_job_id_(0),
       shared_to_unoptimized_job_id_(isolate->heap()),
@@ -98,6 +99,10 @@ bool CompilerDispatcher::IsEnqueued(JobId job_id) const {
   return jobs_.find(job_id) != jobs_.end();
 }
 
+bool CompilerDispatcher::CanEnqueueLazyJob() const {
+  return jobs_.size() < kMaxOutstandingLazyJobs;
+}
+
 void CompilerDispatcher::RegisterSharedFunctionInfo(
     JobId job_id, SharedFunctionInfo function) {
   DCHECK_NE(jobs_.find(job_id), jobs_.end());
@@ -229,13 +234,26 @@ CompilerDispatcher::JobMap::const_iterator CompilerDispatcher::GetJobFor(
 
 void CompilerDispatcher::ScheduleIdleTaskFromAnyThread(
     const base::MutexGuard&) {
-  if (!taskrunner_->IdleTasksEnabled()) return;
   if (idle_task_scheduled_) return;
+  bool idle_tasks_enabled = taskrunner_->IdleTasksEnabled();
+  if (!idle_tasks_enabled && !finalize_in_foreground_tasks_) return;
 
   idle_task_scheduled_ = true;
-  taskrunner_->PostIdleTask(MakeCancelableIdleTask(
-      task_manager_.get(),
-      [this](double deadline_in_seconds) { DoIdleWork(deadline_in_seconds); }));
+  if (idle_tasks_enabled) {
+    taskrunner_->PostIdleTask(
+        MakeCancelableIdleTask(task_manager_.get(),
+                               [this](double deadline_in_seconds) {
+                                 DoIdleWork(deadline_in_seconds);
+                               }));
+  } else {
+    // Without idle time, finalize finished jobs in batches from regular
+    // foreground tasks instead of leaving them all to FinishNow on first call.
+    // Each batch is bounded so that the main thread stays responsive.
+    taskrunner_->PostTask(MakeCancelableTask(task_manager_.get(), [this] {
+      DoIdleWork(platform_->MonotonicallyIncreasingTime() +
+                 kFinalizationBatchTimeInSeconds);
+    }));
+  }
 }
 
 void CompilerDispatcher::ScheduleMoreWorkerTasksIfNeeded() {
@@ -319,16 +337,18 @@ void CompilerDispatcher::DoIdleWork(double deadline_in_seconds) {
            (deadline_in_seconds - platform_->MonotonicallyIncreasingTime()) *
                static_cast<double>(base::Time::kMillisecondsPerSecond));
   }
+  // Jobs are visited at most once per call, since any job which becomes ready
+  // for finalization in the meantime schedules another idle task.
+  CompilerDispatcher::JobMap::const_iterator it = jobs_.cbegin();
   while (deadline_in_seconds > platform_->MonotonicallyIncreasingTime()) {
     // Find a job which is pending finalization and has a shared function info
-    CompilerDispatcher::JobMap::const_iterator it;
     {
       base::MutexGuard lock(&mutex_);
-      for (it = jobs_.cbegin(); it != jobs_.cend(); ++it) {
+      for (; it != jobs_.cend(); ++it) {
         if (it->second->IsReadyToFinalize(lock)) break;
       }
-      // Since we hold the lock here, we can be sure no jobs have become ready
-      // for finalization while we looped through the list.
+      // Jobs before {it} that have become ready for finalization while we
+      // looped through the list have scheduled another idle task.
       if (it == jobs_.cend()) return;
 
       DCHECK(it->second->IsReadyToFinalize(lock));
@@ -344,7 +364,7 @@ void CompilerDispatcher::DoIdleWork(double deadline_in_seconds) {
           job->task.get(), job->function.ToHandleChecked(), isolate_,
           Compiler::CLEAR_EXCEPTION);
     }
-    RemoveJob(it);
+    it = RemoveJob(it);
   }
 
   // We didn't return above so there still might be jobs to finalize.
@@ -68,7 +68,10 @@ class Handle;
 //
 // CompilerDispatcher::DoIdleWork tries to advance as many jobs out of jobs_ as
 // possible during idle time. If a job can't be advanced, but is suitable for
-// background processing, it fires off background threads.
+// background processing, it fires off background threads. If the platform
+// doesn't support idle tasks and --parallel-compile-tasks-for-lazy is enabled,
+// DoIdleWork runs from regular foreground tasks instead and finalizes finished
+// jobs in small batches.
 //
 // CompilerDispatcher::DoBackgroundWork advances one of the pending jobs, and
 // then spins of another idle task to potentially do the final step on the main
@@ -97,6 +100,15 @@ class V8_EXPORT_PRIVATE CompilerDispatcher {
   // Returns true if there is a pending job registered for the given function.
   bool IsEnqueued(Handle<SharedFunctionInfo> function) const;
 
+  // Returns true if a job for a lazily compiled function may be enqueued
+  // without exceeding kMaxOutstandingLazyJobs (see
+  // --parallel-compile-tasks-for-lazy).
+  bool CanEnqueueLazyJob() const;
+
+  // Maximum number of outstanding jobs up to which jobs for lazily compiled
+  // functions are enqueued.
+  static constexpr size_t kMaxOutstandingLazyJobs = 64;
+
   // Blocks until the given function is compiled (and does so as fast as
   // possible). Returns true if the compile job was successful.
   bool FinishNow(Handle<SharedFunctionInfo> function);
@@ -116,6 +128,12 @@ class V8_EXPORT_PRIVATE CompilerDispatcher {
   FRIEND_TEST(CompilerDispatcherTest, AsyncAbortAllPendingWorkerTask);
   FRIEND_TEST(CompilerDispatcherTest, AsyncAbortAllRunningWorkerTask);
   FRIEND_TEST(CompilerDispatcherTest, CompileMultipleOnBackgroundThread);
+  FRIEND_TEST(CompilerDispatcherTest, FinalizeInBatchesWithoutIdleTasks);
+  FRIEND_TEST(CompilerDispatcherTest, NoFinalizationWithoutIdleTasks);
+
+  // Time budget for finalizing jobs from a regular foreground task when the
+  // platform doesn't support idle tasks.
+  static constexpr double kFinalizationBatchTimeInSeconds = 0.001;
 
   struct Job {
     explicit Job(BackgroundCompileTask* task_arg);
@@ -161,6 +179,10 @@ class V8_EXPORT_PRIVATE CompilerDispatcher {
   // Copy of FLAG_trace_compiler_dispatcher to allow for access from any thread.
   bool trace_compiler_dispatcher_;
 
+  // Copy of FLAG_parallel_compile_tasks_for_lazy to allow for access from any
+  // thread.
+  bool finalize_in_foreground_tasks_;
+
   std::unique_ptr<CancelableTaskManager> task_manager_;
 
   // Id for next job to be added
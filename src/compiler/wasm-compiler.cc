@@ -182,7 +182,8 @@ WasmGraphBuilder::WasmGraphBuilder(
       has_simd_(ContainsSimd(sig)),
       untrusted_code_mitigations_(FLAG_untrusted_code_mitigations),
       sig_(sig),
-      source_position_table_(source_position_table) {
+      source_position_table_(source_position_table),
+      bounds_checks_(zone) {
   DCHECK_IMPLIES(use_trap_handler(), trap_handler::IsTrapHandlerEnabled());
   DCHECK_NOT_NULL(mcgraph_);
 }
@@ -3588,6 +3589,7 @@ Node* WasmGraphBuilder::BoundsCheckMem(uint8_t access_size, Node* index,
                                        wasm::WasmCodePosition position,
                                        EnforceBoundsCheck enforce_check) {
   DCHECK_LE(1, access_size);
+  Node* index32 = index;
   index = Uint32ToUintptr(index);
   if (FLAG_wasm_no_bounds_checks) return index;
 
@@ -3601,6 +3603,16 @@ Node* WasmGraphBuilder::BoundsCheckMem(uint8_t access_size, Node* index,
     return mcgraph()->IntPtrConstant(0);
   }
   uint64_t end_offset = uint64_t{offset} + access_size - 1u;
+
+  auto m = mcgraph()->machine();
+  if (FLAG_wasm_merge_bounds_checks &&
+      IsBoundsCheckRedundant(index32, end_offset)) {
+    if (untrusted_code_mitigations_) {
+      index = graph()->NewNode(m->WordAnd(), index, instance_cache_->mem_mask);
+    }
+    return index;
+  }
+
   Node* end_offset_node = IntPtrConstant(end_offset);
 
   // The accessed memory is [index + offset, index + end_offset].
@@ -3612,7 +3624,6 @@ Node* WasmGraphBuilder::BoundsCheckMem(uint8_t access_size, Node* index,
   //    - computing {effective_size} as {mem_size - end_offset} and
   //    - checking that {index < effective_size}.
 
-  auto m = mcgraph()->machine();
   Node* mem_size = instance_cache_->mem_size;
   if (end_offset >= env_->min_memory_size) {
     // The end offset is larger than the smallest memory.
@@ -3640,6 +3651,7 @@ Node* WasmGraphBuilder::BoundsCheckMem(uint8_t access_size, Node* index,
   // Introduce the actual bounds check.
   Node* cond = graph()->NewNode(m->UintLessThan(), index, effective_size);
   TrapIfFalse(wasm::kTrapMemOutOfBounds, cond, position);
+  if (FLAG_wasm_merge_bounds_checks) RecordBoundsCheck(index32, end_offset);
 
   if (untrusted_code_mitigations_) {
     // In the fallthrough case, condition the index with the memory mask.
@@ -3650,6 +3662,33 @@ Node* WasmGraphBuilder::BoundsCheckMem(uint8_t access_size, Node* index,
   return index;
 }
 
+bool WasmGraphBuilder::IsBoundsCheckRedundant(Node* index,
+                                              uint64_t end_offset) {
+  // Any change of control other than by a bounds check (branches, merges,
+  // loops) invalidates the recorded checks, since they might not dominate the
+  // current position anymore.
+  if (Control() != bounds_checks_control_) {
+    bounds_checks_.clear();
+    return false;
+  }
+  // Only reuse checks against the same {mem_size} node. Memory can only grow,
+  // so this is conservative.
+  for (const BoundsCheck& check : bounds_checks_) {
+    if (check.index == index && check.mem_size == instance_cache_->mem_size &&
+        check.end_offset >= end_offset) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void WasmGraphBuilder::RecordBoundsCheck(Node* index, uint64_t end_offset) {
+  // The new check only extended the control chain which
+  // {IsBoundsCheckRedundant} validated, so all previous checks still dominate.
+  bounds_checks_.push_back({index, instance_cache_->mem_size, end_offset});
+  bounds_checks_control_ = Control();
+}
+
 Node* WasmGraphBuilder::BoundsCheckRange(Node* start, Node** size, Node* max,
                                          wasm::WasmCodePosition position) {
   auto m = mcgraph()->machine();
@@ -4744,8 +4783,160 @@ Node* WasmGraphBuilder::DataDrop(uint32_t data_segment_index,
                        mcgraph()->Int32Constant(1), Effect(), Control()));
 }
 
+namespace {
+
+// Bulk memory operations with a constant size up to this many bytes are
+// emitted as a sequence of loads and stores instead of a C call.
+constexpr uint32_t kMaxInlineBulkMemorySize = 64;
+
+// Returns the widest machine type of at most {remaining} bytes which can be
+// used to copy or fill a chunk of memory.
+MachineType BulkMemoryChunkType(MachineGraph* mcgraph, uint32_t remaining) {
+  if (mcgraph->machine()->Is64() && remaining >= 8) {
+    return MachineType::Uint64();
+  }
+  if (remaining >= 4) return MachineType::Uint32();
+  if (remaining >= 2) return MachineType::Uint16();
+  return MachineType::Uint8();
+}
+
+}  // namespace
+
+bool WasmGraphBuilder::IsInlineBulkMemorySize(Node* size,
+                                              uint32_t* inline_size) {
+  Uint32Matcher m(size);
+  if (!m.HasValue() || m.Value() == 0 ||
+      m.Value() > kMaxInlineBulkMemorySize) {
+    return false;
+  }
+  *inline_size = m.Value();
+  return true;
+}
+
+Node* WasmGraphBuilder::IsMemRangeInBounds(Node* start, uint32_t size) {
+  auto m = mcgraph()->machine();
+  // The range [start, start + size) is in bounds iff {size <= mem_size} and
+  // {start <= mem_size - size}. The first check makes sure that the
+  // subtraction in the second one does not underflow.
+  Node* mem_size = instance_cache_->mem_size;
+  Node* size_node = Int32Constant(static_cast<int32_t>(size));
+  Node* size_fits =
+      graph()->NewNode(m->Uint32LessThanOrEqual(), size_node, mem_size);
+  Node* start_fits = graph()->NewNode(
+      m->Uint32LessThanOrEqual(), start,
+      graph()->NewNode(m->Int32Sub(), mem_size, size_node));
+  return graph()->NewNode(m->Word32And(), size_fits, start_fits);
+}
+
+void WasmGraphBuilder::BuildInlineMemoryCopy(Node* dst, Node* src,
+                                             uint32_t size) {
+  DCHECK_LE(size, kMaxInlineBulkMemorySize);
+  auto m = mcgraph()->machine();
+  Node* dst_ptr = graph()->NewNode(m->IntAdd(), MemBuffer(0),
+                                   Uint32ToUintptr(dst));
+  Node* src_ptr = graph()->NewNode(m->IntAdd(), MemBuffer(0),
+                                   Uint32ToUintptr(src));
+  // Load the whole source range before storing anything, so that overlapping
+  // ranges are handled like {memmove} would.
+  Node* values[kMaxInlineBulkMemorySize];
+  MachineType types[kMaxInlineBulkMemorySize];
+  int num_chunks = 0;
+  for (uint32_t offset = 0; offset < size;) {
+    MachineType type = BulkMemoryChunkType(mcgraph(), size - offset);
+    const Operator* load_op =
+        m->UnalignedLoadSupported(type.representation())
+            ? m->Load(type)
+            : m->UnalignedLoad(type);
+    values[num_chunks] = SetEffect(graph()->NewNode(
+        load_op, src_ptr, mcgraph()->IntPtrConstant(offset), Effect(),
+        Control()));
+    types[num_chunks] = type;
+    ++num_chunks;
+    offset += ElementSizeInBytes(type.representation());
+  }
+  uint32_t offset = 0;
+  for (int i = 0; i < num_chunks; ++i) {
+    MachineRepresentation rep = types[i].representation();
+    const Operator* store_op =
+        m->UnalignedStoreSupported(rep)
+            ? m->Store(StoreRepresentation(rep, kNoWriteBarrier))
+            : m->UnalignedStore(UnalignedStoreRepresentation(rep));
+    SetEffect(graph()->NewNode(store_op, dst_ptr,
+                               mcgraph()->IntPtrConstant(offset), values[i],
+                               Effect(), Control()));
+    offset += ElementSizeInBytes(rep);
+  }
+}
+
+void WasmGraphBuilder::BuildInlineMemoryFill(Node* dst, Node* value,
+                                             uint32_t size) {
+  DCHECK_LE(size, kMaxInlineBulkMemorySize);
+  auto m = mcgraph()->machine();
+  Node* dst_ptr = graph()->NewNode(m->IntAdd(), MemBuffer(0),
+                                   Uint32ToUintptr(dst));
+  // Replicate the low byte of {value} into every byte of a word.
+  Node* low_byte =
+      graph()->NewNode(m->Word32And(), value, Int32Constant(0xFF));
+  Node* pattern32 =
+      graph()->NewNode(m->Int32Mul(), low_byte, Int32Constant(0x01010101));
+  Node* pattern64 = nullptr;
+  if (m->Is64() && size >= 8) {
+    Node* low = graph()->NewNode(m->ChangeUint32ToUint64(), pattern32);
+    pattern64 = graph()->NewNode(
+        m->Word64Or(), low,
+        graph()->NewNode(m->Word64Shl(), low, Int64Constant(32)));
+  }
+  for (uint32_t offset = 0; offset < size;) {
+    MachineRepresentation rep =
+        BulkMemoryChunkType(mcgraph(), size - offset).representation();
+    const Operator* store_op =
+        m->UnalignedStoreSupported(rep)
+            ? m->Store(StoreRepresentation(rep, kNoWriteBarrier))
+            : m->UnalignedStore(UnalignedStoreRepresentation(rep));
+    Node* pattern =
+        rep == MachineRepresentation::kWord64 ? pattern64 : pattern32;
+    SetEffect(graph()->NewNode(store_op, dst_ptr,
+                               mcgraph()->IntPtrConstant(offset), pattern,
+                               Effect(), Control()));
+    offset += ElementSizeInBytes(rep);
+  }
+}
+
 Node* WasmGraphBuilder::MemoryCopy(Node* dst, Node* src, Node* size,
                                    wasm::WasmCodePosition position) {
+  uint32_t inline_size;
+  if (!IsInlineBulkMemorySize(size, &inline_size)) {
+    return BuildMemoryCopyCall(dst, src, size, position);
+  }
+  // Copy small constant-size ranges inline if both of them are fully in
+  // bounds. Partially out-of-bounds copies take the generic path, which
+  // copies the in-bounds part before trapping.
+  auto m = mcgraph()->machine();
+  Node* in_bounds =
+      graph()->NewNode(m->Word32And(), IsMemRangeInBounds(dst, inline_size),
+                       IsMemRangeInBounds(src, inline_size));
+  Node* if_inline;
+  Node* if_call;
+  BranchExpectTrue(in_bounds, &if_inline, &if_call);
+  Node* effect = Effect();
+
+  SetControl(if_inline);
+  BuildInlineMemoryCopy(dst, src, inline_size);
+  Node* controls[] = {Control(), nullptr};
+  Node* effects[] = {Effect(), nullptr};
+
+  SetEffect(effect);
+  SetControl(if_call);
+  BuildMemoryCopyCall(dst, src, size, position);
+  controls[1] = Control();
+  effects[1] = Effect();
+
+  Node* merge = SetControl(Merge(2, controls));
+  return SetEffect(EffectPhi(2, effects, merge));
+}
+
+Node* WasmGraphBuilder::BuildMemoryCopyCall(Node* dst, Node* src, Node* size,
+                                            wasm::WasmCodePosition position) {
   auto m = mcgraph()->machine();
   // The data must be copied backward if the regions overlap and src < dst. The
   // regions overlap if {src + size > dst && dst + size > src}. Since we already
@@ -4783,6 +4974,33 @@ Node* WasmGraphBuilder::MemoryCopy(Node* dst, Node* src, Node* size,
 
 Node* WasmGraphBuilder::MemoryFill(Node* dst, Node* value, Node* size,
                                    wasm::WasmCodePosition position) {
+  uint32_t inline_size;
+  if (!IsInlineBulkMemorySize(size, &inline_size)) {
+    return BuildMemoryFillCall(dst, value, size, position);
+  }
+  // Fill small constant-size ranges inline if they are fully in bounds.
+  Node* if_inline;
+  Node* if_call;
+  BranchExpectTrue(IsMemRangeInBounds(dst, inline_size), &if_inline, &if_call);
+  Node* effect = Effect();
+
+  SetControl(if_inline);
+  BuildInlineMemoryFill(dst, value, inline_size);
+  Node* controls[] = {Control(), nullptr};
+  Node* effects[] = {Effect(), nullptr};
+
+  SetEffect(effect);
+  SetControl(if_call);
+  BuildMemoryFillCall(dst, value, size, position);
+  controls[1] = Control();
+  effects[1] = Effect();
+
+  Node* merge = SetControl(Merge(2, controls));
+  return SetEffect(EffectPhi(2, effects, merge));
+}
+
+Node* WasmGraphBuilder::BuildMemoryFillCall(Node* dst, Node* value, Node* size,
+                                            wasm::WasmCodePosition position) {
   Node* fail = BoundsCheckMemRange(&dst, &size, position);
   Node* function = graph()->NewNode(mcgraph()->common()->ExternalConstant(
       ExternalReference::wasm_memory_fill()));
@@ -5661,7 +5879,7 @@ class WasmWrapperGraphBuilder : public WasmGraphBuilder {
     return true;
   }
 
-  void BuildCapiCallWrapper(Address address) {
+  void BuildCapiCallWrapper() {
     // Store arguments on our stack, then align the stack for calling to C.
     int param_bytes = 0;
     for (wasm::ValueType type : sig_->parameters()) {
@@ -5702,6 +5920,9 @@ class WasmWrapperGraphBuilder : public WasmGraphBuilder {
     Node* host_data = LOAD_RAW(
         sfi_data, WasmCapiFunctionData::kEmbedderDataOffset - kHeapObjectTag,
         MachineType::Pointer());
+    Node* function = LOAD_RAW(
+        sfi_data, WasmCapiFunctionData::kCallTargetOffset - kHeapObjectTag,
+        MachineType::Pointer());
 
     BuildModifyThreadInWasmFlag(false);
     Node* isolate_root =
@@ -5710,12 +5931,6 @@ class WasmWrapperGraphBuilder : public WasmGraphBuilder {
     STORE_RAW(isolate_root, Isolate::c_entry_fp_offset(), fp_value,
               MachineType::PointerRepresentation(), kNoWriteBarrier);
 
-    // TODO(jkummerow): Load the address from the {host_data}, and cache
-    // wrappers per signature.
-    const ExternalReference ref = ExternalReference::Create(address);
-    Node* function =
-        graph()->NewNode(mcgraph()->common()->ExternalConstant(ref));
-
     // Parameters: void* data, Address arguments.
     MachineType host_sig_types[] = {
         MachineType::Pointer(), MachineType::Pointer(), MachineType::Pointer()};
@@ -6263,8 +6478,7 @@ wasm::WasmCompilationResult CompileWasmImportCallWrapper(
 
 wasm::WasmCode* CompileWasmCapiCallWrapper(wasm::WasmEngine* wasm_engine,
                                            wasm::NativeModule* native_module,
-                                           wasm::FunctionSig* sig,
-                                           Address address) {
+                                           wasm::FunctionSig* sig) {
   TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.wasm"), "CompileWasmCapiFunction");
 
   Zone zone(wasm_engine->allocator(), ZONE_NAME);
@@ -6294,7 +6508,7 @@ wasm::WasmCode* CompileWasmCapiCallWrapper(wasm::WasmEngine* wasm_engine,
   builder.set_effect_ptr(&effect);
   builder.set_control_ptr(&control);
   builder.set_instance_node(builder.Param(wasm::kWasmInstanceParameterIndex));
-  builder.BuildCapiCallWrapper(address);
+  builder.BuildCapiCallWrapper();
 
   // Run the compiler pipeline to generate machine code.
   CallDescriptor* call_descriptor =
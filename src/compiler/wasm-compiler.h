@@ -120,9 +120,11 @@ V8_EXPORT_PRIVATE wasm::WasmCompilationResult CompileWasmImportCallWrapper(
     wasm::FunctionSig*, bool source_positions);
 
 // Compiles a host call wrapper, which allows WASM to call host functions.
+// The wrapper only depends on the signature; the host function to call is
+// loaded from the {WasmCapiFunctionData} of the callable passed at runtime.
 wasm::WasmCode* CompileWasmCapiCallWrapper(wasm::WasmEngine*,
                                            wasm::NativeModule*,
-                                           wasm::FunctionSig*, Address address);
+                                           wasm::FunctionSig*);
 
 // Returns an OptimizedCompilationJob object for a JS to Wasm wrapper.
 std::unique_ptr<OptimizedCompilationJob> NewJSToWasmCompilationJob(
@@ -452,12 +454,28 @@ class WasmGraphBuilder {
 
   compiler::SourcePositionTable* const source_position_table_ = nullptr;
 
+  // An explicit bounds check which established that {index + end_offset} is
+  // below {mem_size}.
+  struct BoundsCheck {
+    Node* index;
+    Node* mem_size;
+    uint64_t end_offset;
+  };
+  // Bounds checks emitted since control last changed for another reason than
+  // a bounds check. All of them dominate the current control.
+  ZoneVector<BoundsCheck> bounds_checks_;
+  Node* bounds_checks_control_ = nullptr;
+
   Node* NoContextConstant();
 
   Node* MemBuffer(uint32_t offset);
   // BoundsCheckMem receives a uint32 {index} node and returns a ptrsize index.
   Node* BoundsCheckMem(uint8_t access_size, Node* index, uint32_t offset,
                        wasm::WasmCodePosition, EnforceBoundsCheck);
+  // Returns true if a dominating bounds check already established that
+  // {index + end_offset} is in bounds.
+  bool IsBoundsCheckRedundant(Node* index, uint64_t end_offset);
+  void RecordBoundsCheck(Node* index, uint64_t end_offset);
   // Check that the range [start, start + size) is in the range [0, max).
   // Also updates *size with the valid range. Returns true if the range is
   // partially out-of-bounds, traps if it is completely out-of-bounds.
@@ -468,6 +486,19 @@ class WasmGraphBuilder {
   // to a pointer into memory at that index. Returns true if the range is
   // partially out-of-bounds, traps if it is completely out-of-bounds.
   Node* BoundsCheckMemRange(Node** start, Node** size, wasm::WasmCodePosition);
+  // Returns a node which is true iff the range [start, start + size) is
+  // completely in bounds. {start} is a uint32 index.
+  Node* IsMemRangeInBounds(Node* start, uint32_t size);
+
+  // Returns true if a bulk memory operation of {size} bytes should be emitted
+  // inline. In that case, {*inline_size} is set to the constant size.
+  bool IsInlineBulkMemorySize(Node* size, uint32_t* inline_size);
+  void BuildInlineMemoryCopy(Node* dst, Node* src, uint32_t size);
+  void BuildInlineMemoryFill(Node* dst, Node* value, uint32_t size);
+  Node* BuildMemoryCopyCall(Node* dst, Node* src, Node* size,
+                            wasm::WasmCodePosition position);
+  Node* BuildMemoryFillCall(Node* dst, Node* value, Node* size,
+                            wasm::WasmCodePosition position);
 
   Node* CheckBoundsAndAlignment(uint8_t access_size, Node* index,
                                 uint32_t offset, wasm::WasmCodePosition);
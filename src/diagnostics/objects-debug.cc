@@ -1464,20 +1464,45 @@ void JSRegExp::JSRegExpVerify(Isolate* isolate) {
       break;
     }
     case JSRegExp::IRREGEXP: {
-      bool is_native = RegExp::GeneratesNativeCode();
-
       FixedArray arr = FixedArray::cast(data());
       Object one_byte_data = arr.get(JSRegExp::kIrregexpLatin1CodeIndex);
       // Smi : Not compiled yet (-1).
-      // Code/ByteArray: Compiled code.
+      // Code: Compiled code.
       CHECK((one_byte_data.IsSmi() &&
              Smi::ToInt(one_byte_data) == JSRegExp::kUninitializedValue) ||
-            (is_native ? one_byte_data.IsCode() : one_byte_data.IsByteArray()));
+            one_byte_data.IsCode());
       Object uc16_data = arr.get(JSRegExp::kIrregexpUC16CodeIndex);
       CHECK((uc16_data.IsSmi() &&
              Smi::ToInt(uc16_data) == JSRegExp::kUninitializedValue) ||
-            (is_native ? uc16_data.IsCode() : uc16_data.IsByteArray()));
-
+            uc16_data.IsCode());
+      // Smi : Not compiled yet (-1).
+      // ByteArray: Bytecode for the interpreter.
+      Object one_byte_bytecode =
+          arr.get(JSRegExp::kIrregexpLatin1BytecodeIndex);
+      CHECK((one_byte_bytecode.IsSmi() &&
+             Smi::ToInt(one_byte_bytecode) == JSRegExp::kUninitializedValue) ||
+            one_byte_bytecode.IsByteArray());
+      Object uc16_bytecode = arr.get(JSRegExp::kIrregexpUC16BytecodeIndex);
+      CHECK((uc16_bytecode.IsSmi() &&
+             Smi::ToInt(uc16_bytecode) == JSRegExp::kUninitializedValue) ||
+            uc16_bytecode.IsByteArray());
+      CHECK(arr.get(JSRegExp::kIrregexpTicksUntilTierUpIndex).IsSmi());
+      // Smi : No literal prefix (-1).
+      // String: Literal that every match starts with.
+      Object prefix = arr.get(JSRegExp::kIrregexpLiteralPrefixIndex);
+      CHECK((prefix.IsSmi() &&
+             Smi::ToInt(prefix) == JSRegExp::kUninitializedValue) ||
+            prefix.IsString());
+      CHECK(arr.get(JSRegExp::kIrregexpCaptureCountIndex).IsSmi());
+      CHECK(arr.get(JSRegExp::kIrregexpMaxRegisterCountIndex).IsSmi());
+      break;
+    }
+    case JSRegExp::EXPERIMENTAL: {
+      FixedArray arr = FixedArray::cast(data());
+      Smi uninitialized = Smi::FromInt(JSRegExp::kUninitializedValue);
+      CHECK_EQ(uninitialized, arr.get(JSRegExp::kIrregexpLatin1CodeIndex));
+      CHECK_EQ(uninitialized, arr.get(JSRegExp::kIrregexpUC16CodeIndex));
+      CHECK(arr.get(JSRegExp::kIrregexpLatin1BytecodeIndex).IsByteArray());
       CHECK(arr.get(JSRegExp::kIrregexpCaptureCountIndex).IsSmi());
       CHECK(arr.get(JSRegExp::kIrregexpMaxRegisterCountIndex).IsSmi());
       break;
@@ -1682,7 +1707,9 @@ void WasmExportedFunctionData::WasmExportedFunctionDataVerify(
     Isolate* isolate) {
   TorqueGeneratedClassVerifiers::WasmExportedFunctionDataVerify(*this, isolate);
   CHECK(wrapper_code().kind() == Code::JS_TO_WASM_FUNCTION ||
-        wrapper_code().kind() == Code::C_WASM_ENTRY);
+        wrapper_code().kind() == Code::C_WASM_ENTRY ||
+        wrapper_code().builtin_index() ==
+            Builtins::kWasmCompileJSToWasmWrapperLazy);
 }
 
 USE_TORQUE_VERIFIER(WasmModuleObject)
@@ -4504,6 +4504,29 @@ void Isolate::CountUsage(v8::Isolate::UseCounterFeature feature) {
   }
 }
 
+void Isolate::StartCodeCacheWarmUp() {
+  Handle<WeakArrayList> list;
+  if (code_cache_warm_up_functions_.ToHandle(&list)) {
+    GlobalHandles::Destroy(list.location());
+  }
+  code_cache_warm_up_functions_ =
+      global_handles()->Create(ReadOnlyRoots(this).empty_weak_array_list());
+  is_recording_code_cache_warm_up_ = true;
+}
+
+void Isolate::RecordCodeCacheWarmUp(Handle<SharedFunctionInfo> shared) {
+  if (!is_recording_code_cache_warm_up_) return;
+  // Only functions that belong to a script can end up in a code cache.
+  if (!shared->script().IsScript()) return;
+  Handle<WeakArrayList> list = code_cache_warm_up_functions_.ToHandleChecked();
+  Handle<WeakArrayList> new_list =
+      WeakArrayList::AddToEnd(this, list, MaybeObjectHandle::Weak(shared));
+  if (!new_list.is_identical_to(list)) {
+    GlobalHandles::Destroy(list.location());
+    code_cache_warm_up_functions_ = global_handles()->Create(*new_list);
+  }
+}
+
 // static
 std::string Isolate::GetTurboCfgFileName(Isolate* isolate) {
   if (FLAG_trace_turbo_cfg_file == nullptr) {
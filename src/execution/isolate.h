@@ -420,6 +420,11 @@ using DebugObjectCache = std::vector<Handle<HeapObject>>;
   V(int, code_and_metadata_size, 0)                                            \
   V(int, bytecode_and_metadata_size, 0)                                        \
   V(int, external_script_source_size, 0)                                       \
+  /* Code cache consumption and lazy compile statistics. */                    \
+  V(size_t, code_cache_hits, 0)                                                \
+  V(size_t, code_cache_rejects, 0)                                             \
+  V(size_t, lazy_compiles, 0)                                                  \
+  V(size_t, lazy_compiles_with_preparse_data, 0)                               \
   /* true if being profiled. Causes collection of extra compile info. */       \
   V(bool, is_profiling, false)                                                 \
   /* Number of CPU profilers running on the isolate. */                        \
@@ -1361,6 +1366,16 @@ class Isolate final : private HiddenFactory {
 
   static std::string GetTurboCfgFileName(Isolate* isolate);
 
+  // Records the functions compiled between StartCodeCacheWarmUp and
+  // StopCodeCacheWarmUp, so that code caches created later can include them.
+  void StartCodeCacheWarmUp();
+  void StopCodeCacheWarmUp() { is_recording_code_cache_warm_up_ = false; }
+  void RecordCodeCacheWarmUp(Handle<SharedFunctionInfo> shared);
+  // Returns the functions recorded during the last warm-up, if any.
+  MaybeHandle<WeakArrayList> code_cache_warm_up_functions() const {
+    return code_cache_warm_up_functions_;
+  }
+
 #if V8_SFI_HAS_UNIQUE_ID
   int GetNextUniqueSharedFunctionInfoId() { return next_unique_sfi_id_++; }
 #endif
@@ -1799,6 +1814,10 @@ class Isolate final : private HiddenFactory {
 
   bool force_slow_path_ = false;
 
+  bool is_recording_code_cache_warm_up_ = false;
+  // Global handle to the weak list of functions compiled during warm-up.
+  MaybeHandle<WeakArrayList> code_cache_warm_up_functions_;
+
   int next_optimization_id_ = 0;
 
 #if V8_SFI_HAS_UNIQUE_ID
@@ -608,6 +608,8 @@ DEFINE_BOOL(wasm_write_protect_code_memory, false,
             "write protect code memory on the wasm native heap")
 DEFINE_BOOL(trace_wasm_serialization, false,
             "trace serialization/deserialization")
+DEFINE_BOOL(wasm_lazy_deserialization, false,
+            "install deserialized wasm functions on their first call")
 DEFINE_BOOL(wasm_async_compilation, true,
             "enable actual asynchronous compilation for WebAssembly.compile")
 DEFINE_BOOL(wasm_test_streaming, false,
@@ -682,6 +684,9 @@ FOREACH_WASM_FEATURE_FLAG(DECL_WASM_FLAG, SPACE)
 DEFINE_BOOL(wasm_opt, false, "enable wasm optimization")
 DEFINE_BOOL(wasm_no_bounds_checks, false,
             "disable bounds checks (performance testing only)")
+DEFINE_BOOL(wasm_merge_bounds_checks, false,
+            "omit explicit bounds checks which are implied by a previous "
+            "check of the same index")
 DEFINE_BOOL(wasm_no_stack_checks, false,
             "disable stack checks (performance testing only)")
 DEFINE_BOOL(wasm_math_intrinsics, true,
@@ -693,6 +698,10 @@ DEFINE_IMPLICATION(future, wasm_shared_engine)
 DEFINE_BOOL(wasm_shared_code, true,
             "shares code underlying a wasm module when it is transferred")
 DEFINE_IMPLICATION(future, wasm_shared_code)
+DEFINE_BOOL(wasm_native_module_cache, false,
+            "share compiled code of modules with identical wire bytes between "
+            "all compilations in the process")
+DEFINE_IMPLICATION(future, wasm_native_module_cache)
 DEFINE_BOOL(wasm_trap_handler, true,
             "use signal handlers to catch out of bounds memory access in wasm"
             " (currently Linux x86_64 only)")
@@ -714,14 +723,27 @@ DEFINE_BOOL(wasm_grow_shared_memory, false,
             "allow growing shared WebAssembly memory objects")
 DEFINE_BOOL(wasm_lazy_validation, false,
             "enable lazy validation for lazily compiled wasm functions")
+DEFINE_BOOL(wasm_lazy_js_to_wasm_wrappers, false,
+            "compile JS-to-Wasm wrappers of exported functions on their first "
+            "call instead of at instantiation")
 // wasm-interpret-all resets {asm-,}wasm-lazy-compilation.
 DEFINE_NEG_IMPLICATION(wasm_interpret_all, asm_wasm_lazy_compilation)
 DEFINE_NEG_IMPLICATION(wasm_interpret_all, wasm_lazy_compilation)
 DEFINE_NEG_IMPLICATION(wasm_interpret_all, wasm_tier_up)
+DEFINE_NEG_IMPLICATION(wasm_interpret_all, wasm_native_module_cache)
+DEFINE_NEG_IMPLICATION(wasm_interpret_all, wasm_lazy_deserialization)
 DEFINE_BOOL(wasm_code_gc, true, "enable garbage collection of wasm code")
 DEFINE_BOOL(trace_wasm_code_gc, false, "trace garbage collection of wasm code")
 DEFINE_BOOL(stress_wasm_code_gc, false,
             "stress test garbage collection of wasm code")
+DEFINE_BOOL(wasm_code_aging, false,
+            "evict optimized wasm code that was not found executing for "
+            "several code GCs; it is recompiled lazily when called again")
+DEFINE_INT(wasm_code_aging_threshold, 3,
+           "number of code GCs after which unused optimized wasm code is "
+           "evicted")
+DEFINE_IMPLICATION(wasm_code_aging, wasm_code_gc)
+DEFINE_NEG_IMPLICATION(wasm_interpret_all, wasm_code_aging)
 
 // Profiler flags.
 DEFINE_INT(frame_count, 1, "number of stack frames inspected by the profiler")
@@ -873,6 +895,11 @@ DEFINE_BOOL(flush_bytecode, true,
             "flush of bytecode when it has not been executed recently")
 DEFINE_BOOL(stress_flush_bytecode, false, "stress bytecode flushing")
 DEFINE_IMPLICATION(stress_flush_bytecode, flush_bytecode)
+DEFINE_BOOL(trim_cold_bytecode, false,
+            "discard source position tables of bytecode that has not been "
+            "executed recently, but keep the bytecode itself until it is "
+            "flushed")
+DEFINE_IMPLICATION(trim_cold_bytecode, enable_lazy_source_positions)
 DEFINE_BOOL(use_marking_progress_bar, true,
             "Use a progress bar to scan large objects in increments when "
             "incremental marking is active.")
@@ -1036,6 +1063,10 @@ DEFINE_BOOL(cache_prototype_transitions, true, "cache prototype transitions")
 DEFINE_BOOL(parallel_compile_tasks, false, "enable parallel compile tasks")
 DEFINE_BOOL(compiler_dispatcher, false, "enable compiler dispatcher")
 DEFINE_IMPLICATION(parallel_compile_tasks, compiler_dispatcher)
+DEFINE_BOOL(parallel_compile_tasks_for_lazy, false,
+            "also post lazily compiled top-level functions as parallel "
+            "compile tasks")
+DEFINE_IMPLICATION(parallel_compile_tasks_for_lazy, parallel_compile_tasks)
 DEFINE_BOOL(trace_compiler_dispatcher, false,
             "trace compiler dispatcher activity")
 
@@ -1199,6 +1230,22 @@ DEFINE_UINT(serialization_chunk_size, 4096,
 DEFINE_BOOL(regexp_optimization, true, "generate optimized regexp code")
 DEFINE_BOOL(regexp_mode_modifiers, false, "enable inline flags in regexp.")
 DEFINE_BOOL(regexp_interpret_all, false, "interpret all regexp code")
+DEFINE_BOOL(regexp_peephole_optimization, true,
+            "fuse common regexp bytecode sequences into superinstructions")
+DEFINE_BOOL(regexp_prefix_scan, false,
+            "skip ahead to occurrences of the literal prefix of a regexp "
+            "before running the regexp code")
+DEFINE_BOOL(enable_experimental_regexp_engine, false,
+            "match regexps without backreferences and lookarounds with the "
+            "experimental linear-time engine")
+DEFINE_BOOL(regexp_tier_up, false,
+            "interpret regexp code first and tier up to native code after "
+            "the number of executions given by --regexp-tier-up-ticks")
+DEFINE_INT(regexp_tier_up_ticks, 1,
+           "number of interpreted executions of a regexp before tiering up")
+DEFINE_INT(regexp_tier_up_subject_length, 1000,
+           "tier up a regexp right away when matching it against a subject "
+           "of at least this length")
 
 // Testing flags test/cctest/test-{flags,api,serialization}.cc
 DEFINE_BOOL(testing_bool_flag, true, "testing_bool_flag")
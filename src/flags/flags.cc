@@ -608,6 +608,12 @@ void ComputeFlagListHash() {
       // causing the code cache to get invalidated by this hash.
       continue;
     }
+    if (current->type() == Flag::TYPE_BOOL &&
+        current->bool_variable() == &FLAG_wasm_lazy_deserialization) {
+      // Serialized wasm modules use the same format whether they are
+      // deserialized lazily or eagerly.
+      continue;
+    }
     if (!current->IsDefault()) {
       modified_args_as_string << i;
       modified_args_as_string << *current;
@@ -97,6 +97,7 @@ class ConcurrentMarkingVisitor final
     // It is not safe to access flags from concurrent marking visitor. So
     // set the bytecode flush mode based on the flags here
     bytecode_flush_mode_ = Heap::GetBytecodeFlushMode();
+    trim_cold_bytecode_ = Heap::ShouldTrimColdBytecode();
   }
 
   template <typename T>
@@ -372,6 +373,9 @@ class ConcurrentMarkingVisitor final
     if (shared_info.ShouldFlushBytecode(bytecode_flush_mode_)) {
       weak_objects_->bytecode_flushing_candidates.Push(task_id_, shared_info);
     } else {
+      if (trim_cold_bytecode_ && shared_info.ShouldTrimColdBytecode()) {
+        weak_objects_->cold_bytecode_candidates.Push(task_id_, shared_info);
+      }
       VisitPointer(shared_info, shared_info.RawField(
                                     SharedFunctionInfo::kFunctionDataOffset));
     }
@@ -676,6 +680,7 @@ class ConcurrentMarkingVisitor final
   const unsigned mark_compact_epoch_;
   bool is_forced_gc_;
   BytecodeFlushMode bytecode_flush_mode_;
+  bool trim_cold_bytecode_;
 };
 
 // Strings can change maps due to conversion to thin string or external strings.
@@ -838,6 +843,7 @@ void ConcurrentMarking::Run(int task_id, TaskState* task_state) {
     weak_objects_->weak_cells.FlushToGlobal(task_id);
     weak_objects_->weak_objects_in_code.FlushToGlobal(task_id);
     weak_objects_->bytecode_flushing_candidates.FlushToGlobal(task_id);
+    weak_objects_->cold_bytecode_candidates.FlushToGlobal(task_id);
     weak_objects_->flushed_js_functions.FlushToGlobal(task_id);
     base::AsAtomicWord::Relaxed_Store<size_t>(&task_state->marked_bytes, 0);
     total_marked_bytes_ += marked_bytes;
@@ -319,6 +319,13 @@ class Heap {
     return BytecodeFlushMode::kDoNotFlushBytecode;
   }
 
+  // Like GetBytecodeFlushMode, returns whether the source position tables of
+  // cold bytecode should be trimmed without accessing flags from the
+  // concurrent marker.
+  static inline bool ShouldTrimColdBytecode() {
+    return FLAG_trim_cold_bytecode;
+  }
+
   static uintptr_t ZapValue() {
     return FLAG_clear_free_memory ? kClearedFreeMemoryValue : kZapValue;
   }
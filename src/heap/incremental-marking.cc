@@ -671,6 +671,10 @@ void IncrementalMarking::UpdateWeakReferencesAfterScavenge() {
       [](SharedFunctionInfo candidate) {
         DCHECK(!Heap::InYoungGeneration(candidate));
       });
+  weak_objects_->cold_bytecode_candidates.Iterate(
+      [](SharedFunctionInfo candidate) {
+        DCHECK(!Heap::InYoungGeneration(candidate));
+      });
 #endif
 }
 
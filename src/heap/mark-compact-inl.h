@@ -88,6 +88,10 @@ int MarkingVisitor<fixed_array_mode, retaining_path_mode, MarkingState>::
   if (shared_info.ShouldFlushBytecode(Heap::GetBytecodeFlushMode())) {
     collector_->AddBytecodeFlushingCandidate(shared_info);
   } else {
+    if (Heap::ShouldTrimColdBytecode() &&
+        shared_info.ShouldTrimColdBytecode()) {
+      collector_->AddColdBytecodeCandidate(shared_info);
+    }
     VisitPointer(shared_info,
                  shared_info.RawField(SharedFunctionInfo::kFunctionDataOffset));
   }
@@ -506,6 +510,11 @@ void MarkCompactCollector::AddBytecodeFlushingCandidate(
   weak_objects_.bytecode_flushing_candidates.Push(kMainThread, flush_candidate);
 }
 
+void MarkCompactCollector::AddColdBytecodeCandidate(
+    SharedFunctionInfo cold_candidate) {
+  weak_objects_.cold_bytecode_candidates.Push(kMainThread, cold_candidate);
+}
+
 void MarkCompactCollector::AddFlushedJSFunction(JSFunction flushed_function) {
   weak_objects_.flushed_js_functions.Push(kMainThread, flushed_function);
 }
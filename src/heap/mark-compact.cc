@@ -1967,6 +1967,7 @@ void MarkCompactCollector::ClearNonLiveReferences() {
   {
     TRACE_GC(heap()->tracer(), GCTracer::Scope::MC_CLEAR_FLUSHABLE_BYTECODE);
     ClearOldBytecodeCandidates();
+    TrimColdBytecodeCandidates();
   }
 
   {
@@ -2003,6 +2004,7 @@ void MarkCompactCollector::ClearNonLiveReferences() {
   DCHECK(weak_objects_.js_weak_refs.IsEmpty());
   DCHECK(weak_objects_.weak_cells.IsEmpty());
   DCHECK(weak_objects_.bytecode_flushing_candidates.IsEmpty());
+  DCHECK(weak_objects_.cold_bytecode_candidates.IsEmpty());
   DCHECK(weak_objects_.flushed_js_functions.IsEmpty());
 }
 
@@ -2140,6 +2142,36 @@ void MarkCompactCollector::ClearOldBytecodeCandidates() {
   }
 }
 
+void MarkCompactCollector::TrimColdBytecodeCandidates() {
+  DCHECK(FLAG_trim_cold_bytecode ||
+         weak_objects_.cold_bytecode_candidates.IsEmpty());
+  bool record_stats = TracingFlags::is_gc_stats_enabled();
+  if (V8_UNLIKELY(record_stats)) heap()->CreateObjectStats();
+
+  ReadOnlyRoots roots(heap());
+  SharedFunctionInfo cold_candidate;
+  while (weak_objects_.cold_bytecode_candidates.Pop(kMainThread,
+                                                    &cold_candidate)) {
+    // The debugger relies on the source positions of the original bytecode.
+    if (cold_candidate.HasDebugInfo()) continue;
+
+    BytecodeArray bytecode = cold_candidate.GetBytecodeArray();
+    if (!bytecode.HasSourcePositionTable()) continue;
+
+    // The table itself has already been marked live and is only reclaimed by
+    // the next collection.
+    HeapObject table = HeapObject::cast(bytecode.source_position_table());
+    if (V8_UNLIKELY(record_stats)) {
+      heap()->dead_object_stats_->RecordVirtualObjectStats(
+          ObjectStats::TRIMMED_SOURCE_POSITION_TABLE_TYPE, table.Size(),
+          ObjectStats::kNoOverAllocation);
+    }
+    bytecode.set_source_position_table(roots.undefined_value(),
+                                       SKIP_WRITE_BARRIER);
+    DCHECK(!bytecode.HasSourcePositionTable());
+  }
+}
+
 void MarkCompactCollector::ClearFlushedJsFunctions() {
   DCHECK(FLAG_flush_bytecode || weak_objects_.flushed_js_functions.IsEmpty());
   JSFunction flushed_js_function;
@@ -2409,6 +2441,7 @@ void MarkCompactCollector::AbortWeakObjects() {
   weak_objects_.js_weak_refs.Clear();
   weak_objects_.weak_cells.Clear();
   weak_objects_.bytecode_flushing_candidates.Clear();
+  weak_objects_.cold_bytecode_candidates.Clear();
   weak_objects_.flushed_js_functions.Clear();
 }
 
@@ -451,6 +451,7 @@ struct WeakObjects {
   Worklist<WeakCell, 64> weak_cells;
 
   Worklist<SharedFunctionInfo, 64> bytecode_flushing_candidates;
+  Worklist<SharedFunctionInfo, 64> cold_bytecode_candidates;
   Worklist<JSFunction, 64> flushed_js_functions;
 };
 
@@ -673,6 +674,7 @@ class MarkCompactCollector final : public MarkCompactCollectorBase {
   }
 
   inline void AddBytecodeFlushingCandidate(SharedFunctionInfo flush_candidate);
+  inline void AddColdBytecodeCandidate(SharedFunctionInfo cold_candidate);
   inline void AddFlushedJSFunction(JSFunction flushed_function);
 
   void AddNewlyDiscovered(HeapObject object) {
@@ -805,6 +807,10 @@ class MarkCompactCollector final : public MarkCompactCollectorBase {
   // collections.
   void ClearOldBytecodeCandidates();
 
+  // Discards the source position tables of bytecode arrays that have not been
+  // executed recently. They are recollected lazily when needed.
+  void TrimColdBytecodeCandidates();
+
   // Resets any JSFunctions which have had their bytecode flushed.
   void ClearFlushedJsFunctions();
 
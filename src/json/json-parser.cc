@@ -115,6 +115,62 @@ static const constexpr uint8_t character_json_scan_flags[256] = {
 #undef CALL_GET_SCAN_FLAGS
 };
 
+// Helpers to test all the characters packed into a 64-bit word at once
+// (SIMD within a register). Each predicate sets the high bit of every lane
+// for which it holds and clears all other bits, without false positives.
+template <typename Char>
+struct JsonWord {
+  static constexpr int kLaneBits = kBitsPerByte * sizeof(Char);
+  static constexpr int kChars = sizeof(uint64_t) / sizeof(Char);
+  static constexpr uint64_t kLaneMask = (uint64_t{1} << kLaneBits) - 1;
+  static constexpr uint64_t kOnes = ~uint64_t{0} / kLaneMask;
+  static constexpr uint64_t kHighBits = kOnes << (kLaneBits - 1);
+  static constexpr uint64_t kLowBits = ~kHighBits;
+
+  static V8_INLINE uint64_t Load(const Char* chars) {
+    uint64_t word;
+    memcpy(&word, chars, sizeof(word));
+    return word;
+  }
+
+  static V8_INLINE uint64_t Zero(uint64_t word) {
+    return ~(((word & kLowBits) + kLowBits) | word) & kHighBits;
+  }
+
+  static V8_INLINE uint64_t Equal(uint64_t word, uint8_t c) {
+    return Zero(word ^ (kOnes * c));
+  }
+
+  // Only valid for |c| <= 0x80.
+  static V8_INLINE uint64_t LessThan(uint64_t word, uint8_t c) {
+    DCHECK_LE(c, 0x80);
+    return ~(((word | kHighBits) - kOnes * c) | word) & kHighBits;
+  }
+
+  // Returns the bitwise or of all lanes.
+  static V8_INLINE uc32 OrLanes(uint64_t word) {
+    for (int shift = kLaneBits; shift < 64; shift <<= 1) {
+      word |= word >> shift;
+    }
+    return static_cast<uc32>(word & kLaneMask);
+  }
+};
+
+template <typename Char>
+V8_INLINE bool IsJsonWhitespaceWord(uint64_t word) {
+  using Word = JsonWord<Char>;
+  uint64_t whitespace = Word::Equal(word, ' ') | Word::Equal(word, '\n') |
+                        Word::Equal(word, '\r') | Word::Equal(word, '\t');
+  return whitespace == Word::kHighBits;
+}
+
+template <typename Char>
+V8_INLINE bool MayTerminateJsonStringWord(uint64_t word) {
+  using Word = JsonWord<Char>;
+  return (Word::LessThan(word, 0x20) | Word::Equal(word, '"') |
+          Word::Equal(word, '\\')) != 0;
+}
+
 }  // namespace
 
 MaybeHandle<Object> JsonParseInternalizer::Internalize(Isolate* isolate,
@@ -218,6 +274,10 @@ JsonParser<Char>::JsonParser(Isolate* isolate, Handle<String> source)
     source_ = String::Flatten(isolate, source);
   }
 
+  if (length >= kMinLengthForKeyCache) {
+    key_cache_ = factory()->NewFixedArray(kKeyCacheSize);
+  }
+
   if (StringShape(*source_).IsExternal()) {
     chars_ =
         static_cast<const Char*>(SeqExternalString::cast(*source_).GetChars());
@@ -320,6 +380,13 @@ template <typename Char>
 void JsonParser<Char>::SkipWhitespace() {
   next_ = JsonToken::EOS;
 
+  // Skip indentation in pretty-printed input a word at a time.
+  using Word = JsonWord<Char>;
+  while (end_ - cursor_ >= Word::kChars &&
+         IsJsonWhitespaceWord<Char>(Word::Load(cursor_))) {
+    cursor_ += Word::kChars;
+  }
+
   cursor_ = std::find_if(cursor_, end_, [this](Char c) {
     JsonToken current = V8_LIKELY(c <= unibrow::Latin1::kMaxChar)
                             ? one_char_json_tokens[c]
@@ -398,6 +465,64 @@ Handle<Map> ParentOfDescriptorOwner(Isolate* isolate, Handle<Map> maybe_root,
 }
 }  // namespace
 
+template <typename Char>
+Handle<Map> JsonParser<Char>::GetSiblingFeedback(
+    const JsonContinuation& cont,
+    const std::vector<JsonContinuation>& cont_stack,
+    const std::vector<JsonProperty>& property_stack,
+    const std::vector<Handle<Object>>& element_stack) {
+  // Walk up the enclosing objects to the closest enclosing array, recording
+  // the descriptor index of the property holding each nested object.
+  int path[kMaxSiblingFeedbackDepth];
+  int depth = 0;
+  size_t child_index = cont.index;
+  size_t level = cont_stack.size();
+  while (true) {
+    if (level == 0) return Handle<Map>();
+    const JsonContinuation& parent = cont_stack[level - 1];
+    if (parent.type() == JsonContinuation::kArrayElement) {
+      // Without a previous element there is nothing to predict from. All
+      // levels in between are objects, so the previous element is on top of
+      // the element stack.
+      if (parent.index >= element_stack.size()) return Handle<Map>();
+      break;
+    }
+    if (parent.type() != JsonContinuation::kObjectProperty ||
+        depth == kMaxSiblingFeedbackDepth) {
+      return Handle<Map>();
+    }
+    size_t property_index = child_index - 1;
+    if (property_stack[property_index].string.is_index()) return Handle<Map>();
+    path[depth++] =
+        static_cast<int>(property_index - parent.index) - parent.elements;
+    child_index = parent.index;
+    level--;
+  }
+
+  DisallowHeapAllocation no_gc;
+  Object sibling = *element_stack.back();
+  if (!sibling.IsJSObject() || sibling.IsJSArray()) return Handle<Map>();
+  JSObject object = JSObject::cast(sibling);
+  while (depth > 0) {
+    int descriptor = path[--depth];
+    Map map = object.map();
+    if (map.is_dictionary_map() ||
+        descriptor >= map.NumberOfOwnDescriptors()) {
+      return Handle<Map>();
+    }
+    PropertyDetails details = map.instance_descriptors().GetDetails(descriptor);
+    if (details.kind() != kData || details.location() != kField ||
+        details.representation().IsDouble()) {
+      return Handle<Map>();
+    }
+    Object value =
+        object.RawFastPropertyAt(FieldIndex::ForDescriptor(map, descriptor));
+    if (!value.IsJSObject() || value.IsJSArray()) return Handle<Map>();
+    object = JSObject::cast(value);
+  }
+  return handle(object.map(), isolate_);
+}
+
 template <typename Char>
 Handle<Object> JsonParser<Char>::BuildJsonObject(
     const JsonContinuation& cont,
@@ -820,14 +945,8 @@ MaybeHandle<Object> JsonParser<Char>::ParseJsonValue() {
             break;
           }
 
-          Handle<Map> feedback;
-          if (cont_stack.size() > 0 &&
-              cont_stack.back().type() == JsonContinuation::kArrayElement &&
-              cont_stack.back().index < element_stack.size() &&
-              element_stack.back()->IsJSObject()) {
-            feedback =
-                handle(JSObject::cast(*element_stack.back()).map(), isolate_);
-          }
+          Handle<Map> feedback = GetSiblingFeedback(
+              cont, cont_stack, property_stack, element_stack);
           value = BuildJsonObject(cont, property_stack, feedback);
           property_stack.resize(cont.index);
           Expect(JsonToken::RBRACE);
@@ -963,20 +1082,33 @@ Handle<Object> JsonParser<Char>::ParseJsonNumber() {
 namespace {
 
 template <typename Char>
-bool Matches(const Vector<const Char>& chars, Handle<String> string) {
+bool Matches(const Vector<const Char>& chars, String string) {
   DCHECK(!string.is_null());
 
-  if (chars.length() != string->length()) return false;
+  if (chars.length() != string.length()) return false;
 
   DisallowHeapAllocation no_gc;
-  if (string->IsOneByteRepresentation()) {
-    const uint8_t* string_data = string->GetChars<uint8_t>(no_gc);
+  if (string.IsOneByteRepresentation()) {
+    const uint8_t* string_data = string.GetChars<uint8_t>(no_gc);
     return CompareChars(chars.begin(), string_data, chars.length()) == 0;
   }
-  const uint16_t* string_data = string->GetChars<uint16_t>(no_gc);
+  const uint16_t* string_data = string.GetChars<uint16_t>(no_gc);
   return CompareChars(chars.begin(), string_data, chars.length()) == 0;
 }
 
+// Cheap index into a key cache of |size| entries, looking only at the length
+// and three characters of the (non-empty) key.
+template <typename Char>
+int KeyCacheIndex(const Vector<const Char>& chars, int size) {
+  DCHECK(base::bits::IsPowerOfTwo(size));
+  DCHECK_LT(0, chars.length());
+  uint32_t hash = static_cast<uint32_t>(chars.length());
+  hash = hash * 31 + chars[0];
+  hash = hash * 31 + chars[chars.length() / 2];
+  hash = hash * 31 + chars[chars.length() - 1];
+  return static_cast<int>(hash & (size - 1));
+}
+
 }  // namespace
 
 template <typename Char>
@@ -998,7 +1130,7 @@ Handle<String> JsonParser<Char>::DecodeString(
     if (!string.internalize()) return intermediate;
 
     Vector<const SinkChar> data(dest, string.length());
-    if (!hint.is_null() && Matches(data, hint)) return hint;
+    if (!hint.is_null() && Matches(data, *hint)) return hint;
   }
 
   return factory()->InternalizeString(intermediate, 0, string.length());
@@ -1012,15 +1144,9 @@ Handle<String> JsonParser<Char>::MakeString(const JsonString& string,
   if (string.internalize() && !string.has_escape()) {
     if (!hint.is_null()) {
       Vector<const Char> data(chars_ + string.start(), string.length());
-      if (Matches(data, hint)) return hint;
-    }
-    if (chars_may_relocate_) {
-      return factory()->InternalizeString(Handle<SeqString>::cast(source_),
-                                          string.start(), string.length(),
-                                          string.needs_conversion());
+      if (Matches(data, *hint)) return hint;
     }
-    Vector<const Char> chars(chars_ + string.start(), string.length());
-    return factory()->InternalizeString(chars, string.needs_conversion());
+    return InternalizeKey(string);
   }
 
   if (sizeof(Char) == 1 ? V8_LIKELY(!string.needs_conversion())
@@ -1035,6 +1161,34 @@ Handle<String> JsonParser<Char>::MakeString(const JsonString& string,
   return DecodeString(string, intermediate, hint);
 }
 
+template <typename Char>
+Handle<String> JsonParser<Char>::InternalizeKey(const JsonString& string) {
+  DCHECK(string.internalize());
+  DCHECK(!string.has_escape());
+  int index = -1;
+  if (!key_cache_.is_null()) {
+    DisallowHeapAllocation no_gc;
+    Vector<const Char> chars(chars_ + string.start(), string.length());
+    index = KeyCacheIndex(chars, kKeyCacheSize);
+    Object cached = key_cache_->get(index);
+    if (cached.IsString() && Matches(chars, String::cast(cached))) {
+      return handle(String::cast(cached), isolate_);
+    }
+  }
+
+  Handle<String> key;
+  if (chars_may_relocate_) {
+    key = factory()->InternalizeString(Handle<SeqString>::cast(source_),
+                                       string.start(), string.length(),
+                                       string.needs_conversion());
+  } else {
+    Vector<const Char> chars(chars_ + string.start(), string.length());
+    key = factory()->InternalizeString(chars, string.needs_conversion());
+  }
+  if (index >= 0) key_cache_->set(index, *key);
+  return key;
+}
+
 template <typename Char>
 template <typename SinkChar>
 void JsonParser<Char>::DecodeString(SinkChar* sink, int start, int length) {
@@ -1107,7 +1261,22 @@ JsonString JsonParser<Char>::ScanJsonString(bool needs_internalization) {
   bool has_escape = false;
   uc32 bits = 0;
 
+  using Word = JsonWord<Char>;
   while (true) {
+    // Skip whole words that cannot terminate the string, then find the exact
+    // position within the next word.
+    uint64_t skipped = 0;
+    while (end_ - cursor_ >= Word::kChars) {
+      uint64_t word = Word::Load(cursor_);
+      if (MayTerminateJsonStringWord<Char>(word)) break;
+      skipped |= word;
+      cursor_ += Word::kChars;
+    }
+    if (sizeof(Char) == 2) {
+      uc32 skipped_bits = Word::OrLanes(skipped);
+      if (skipped_bits > unibrow::Latin1::kMaxChar) bits |= skipped_bits;
+    }
+
     cursor_ = std::find_if(cursor_, end_, [&bits](Char c) {
       if (sizeof(Char) == 2 && V8_UNLIKELY(c > unibrow::Latin1::kMaxChar)) {
         bits |= c;
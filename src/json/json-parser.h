@@ -263,6 +263,10 @@ class JsonParser final {
   Handle<String> MakeString(const JsonString& string,
                             Handle<String> hint = Handle<String>());
 
+  // Internalizes the raw, unescaped property key |string|, going through
+  // key_cache_ if it exists.
+  Handle<String> InternalizeKey(const JsonString& string);
+
   template <typename SinkChar>
   void DecodeString(SinkChar* sink, int start, int length);
 
@@ -284,6 +288,16 @@ class JsonParser final {
   // one of "true", "false", or "null", or an object or array literal.
   MaybeHandle<Object> ParseJsonValue();
 
+  // Returns the map of the object at the same position in the previous
+  // element of the closest enclosing array, if any. For example, when parsing
+  // the second "b" in [{"a": {"b": {}}}, {"a": {"b": {}}}], this is the map of
+  // the first "b". BuildJsonObject uses it to predict the final map.
+  Handle<Map> GetSiblingFeedback(
+      const JsonContinuation& cont,
+      const std::vector<JsonContinuation>& cont_stack,
+      const std::vector<JsonProperty>& property_stack,
+      const std::vector<Handle<Object>>& element_stack);
+
   Handle<Object> BuildJsonObject(
       const JsonContinuation& cont,
       const std::vector<JsonProperty>& property_stack, Handle<Map> feedback);
@@ -302,6 +316,15 @@ class JsonParser final {
 
   static const int kInitialSpecialStringLength = 32;
 
+  // Objects nested deeper than this below the closest enclosing array don't
+  // receive sibling feedback.
+  static const int kMaxSiblingFeedbackDepth = 8;
+
+  // Size of the per-parse cache of internalized property keys, and the
+  // minimum source length for which it is allocated.
+  static const int kKeyCacheSize = 128;
+  static const int kMinLengthForKeyCache = 1024;
+
   static void UpdatePointersCallback(v8::Isolate* v8_isolate, v8::GCType type,
                                      v8::GCCallbackFlags flags, void* parser) {
     reinterpret_cast<JsonParser<Char>*>(parser)->UpdatePointers();
@@ -337,6 +360,9 @@ class JsonParser final {
   Handle<JSFunction> object_constructor_;
   const Handle<String> original_source_;
   Handle<String> source_;
+  // Small direct-mapped cache of internalized property keys, so repeated keys
+  // that miss the map feedback skip hashing and the string table lookup.
+  Handle<FixedArray> key_cache_;
 
   // Cached pointer to the raw chars in source. In case source is on-heap, we
   // register an UpdatePointers callback. For this reason, chars_, cursor_ and
@@ -6,6 +6,7 @@
 
 #include "src/common/message-template.h"
 #include "src/numbers/conversions.h"
+#include "src/objects/field-index-inl.h"
 #include "src/objects/heap-number-inl.h"
 #include "src/objects/js-array-inl.h"
 #include "src/objects/lookup.h"
@@ -14,6 +15,7 @@
 #include "src/objects/ordered-hash-table.h"
 #include "src/objects/smi.h"
 #include "src/strings/string-builder-inl.h"
+#include "src/strings/unicode-inl.h"
 #include "src/utils/utils.h"
 
 namespace v8 {
@@ -29,6 +31,10 @@ class JsonStringifier {
                                                       Handle<Object> replacer,
                                                       Handle<Object> gap);
 
+  void set_sink(IncrementalStringBuilder::Sink* sink) {
+    builder_.set_sink(sink);
+  }
+
  private:
   enum Result { UNCHANGED, SUCCESS, EXCEPTION };
 
@@ -82,6 +88,18 @@ class JsonStringifier {
   V8_INLINE Result SerializeJSObject(Handle<JSObject> object,
                                      Handle<Object> key);
 
+  // Returns the plan for serializing objects with the fast-mode {map}: the
+  // enumerable string-keyed own properties in descriptor order, with their
+  // details and whether the key can be copied without escaping. Plans are
+  // cached per map for the duration of the stringify call, so that records of
+  // the same shape don't re-examine the descriptor array for every object.
+  Handle<FixedArray> GetSerializationPlan(Handle<Map> map);
+  static bool IsPlainKey(String key);
+  static bool IsPlainValue(Object value);
+  void SerializePlainKey(bool comma, Handle<String> key);
+  template <typename DestChar>
+  V8_INLINE void AppendPlainKey(String key);
+
   Result SerializeJSProxy(Handle<JSProxy> object, Handle<Object> key);
   Result SerializeJSReceiverSlow(Handle<JSReceiver> object);
   Result SerializeArrayLikeSlow(Handle<JSReceiver> object, uint32_t start,
@@ -133,6 +151,17 @@ class JsonStringifier {
   using KeyObject = std::pair<Handle<Object>, Handle<Object>>;
   std::vector<KeyObject> stack_;
 
+  // Direct-mapped cache of (map, plan) pairs. Empty if the value passed to
+  // Stringify is a primitive, in which case plans are not cached.
+  static const int kPlanCacheSize = 16;
+  Handle<FixedArray> plan_cache_;
+
+  // Layout of the entries of a serialization plan.
+  static const int kPlanKeyOffset = 0;
+  static const int kPlanDetailsOffset = 1;
+  static const int kPlanIsPlainKeyOffset = 2;
+  static const int kPlanEntrySize = 3;
+
   static const int kJsonEscapeTableEntrySize = 8;
   static const char* const JsonEscapeTable;
 };
@@ -143,6 +172,98 @@ MaybeHandle<Object> JsonStringify(Isolate* isolate, Handle<Object> object,
   return stringifier.Stringify(object, replacer, gap);
 }
 
+namespace {
+
+// Encodes the parts of the stringifier's result as UTF-8 and hands them to
+// the embedder in chunks of up to kBufferSize bytes. The result is well-formed
+// UTF-16 except possibly for the gap, so lone surrogates are replaced by
+// U+FFFD. Surrogate pairs may be split across parts.
+class Utf8SinkAdapter final : public IncrementalStringBuilder::Sink {
+ public:
+  explicit Utf8SinkAdapter(v8::JSON::Utf8Sink* sink) : sink_(sink) {}
+
+  void Write(Vector<const uint8_t> chars) override {
+    FlushLeadSurrogate();
+    for (uint8_t c : chars) {
+      if (length_ + 2 > kBufferSize) Flush();
+      length_ += unibrow::Utf8::EncodeOneByte(buffer_ + length_, c);
+    }
+  }
+
+  void Write(Vector<const uc16> chars) override {
+    for (uc16 c : chars) {
+      // A pending lone lead surrogate is written as U+FFFD before {c}.
+      if (length_ + 2 * kMaxEncodedSize > kBufferSize) Flush();
+      if (unibrow::Utf16::IsTrailSurrogate(c) &&
+          lead_surrogate_ != unibrow::Utf16::kNoPreviousCharacter) {
+        uc32 code_point =
+            unibrow::Utf16::CombineSurrogatePair(lead_surrogate_, c);
+        lead_surrogate_ = unibrow::Utf16::kNoPreviousCharacter;
+        length_ += unibrow::Utf8::Encode(buffer_ + length_, code_point,
+                                         unibrow::Utf16::kNoPreviousCharacter,
+                                         false);
+        continue;
+      }
+      FlushLeadSurrogate();
+      if (unibrow::Utf16::IsLeadSurrogate(c)) {
+        lead_surrogate_ = c;
+        continue;
+      }
+      length_ += unibrow::Utf8::Encode(buffer_ + length_, c,
+                                       unibrow::Utf16::kNoPreviousCharacter,
+                                       true);
+    }
+  }
+
+  // Writes out the remaining output. Must be called once the result is
+  // complete.
+  void Finish() {
+    FlushLeadSurrogate();
+    Flush();
+  }
+
+ private:
+  static const int kBufferSize = 8 * KB;
+  static const int kMaxEncodedSize = unibrow::Utf8::kMaxEncodedSize;
+
+  void FlushLeadSurrogate() {
+    if (lead_surrogate_ == unibrow::Utf16::kNoPreviousCharacter) return;
+    if (length_ + kMaxEncodedSize > kBufferSize) Flush();
+    length_ += unibrow::Utf8::Encode(buffer_ + length_, lead_surrogate_,
+                                     unibrow::Utf16::kNoPreviousCharacter,
+                                     true);
+    lead_surrogate_ = unibrow::Utf16::kNoPreviousCharacter;
+  }
+
+  void Flush() {
+    if (length_ == 0) return;
+    sink_->Write(buffer_, static_cast<size_t>(length_));
+    length_ = 0;
+  }
+
+  v8::JSON::Utf8Sink* sink_;
+  int lead_surrogate_ = unibrow::Utf16::kNoPreviousCharacter;
+  int length_ = 0;
+  char buffer_[kBufferSize];
+};
+
+}  // namespace
+
+Maybe<bool> JsonStringifyToSink(Isolate* isolate, Handle<Object> object,
+                                Handle<Object> gap, v8::JSON::Utf8Sink* sink) {
+  Utf8SinkAdapter adapter(sink);
+  JsonStringifier stringifier(isolate);
+  stringifier.set_sink(&adapter);
+  Handle<Object> result;
+  if (!stringifier.Stringify(object, isolate->factory()->undefined_value(), gap)
+           .ToHandle(&result)) {
+    return Nothing<bool>();
+  }
+  if (result->IsUndefined(isolate)) return Just(false);
+  adapter.Finish();
+  return Just(true);
+}
+
 // Translation table to escape Latin1 characters.
 // Table entries start at a multiple of 8 and are null-terminated.
 const char* const JsonStringifier::JsonEscapeTable =
@@ -227,6 +348,12 @@ MaybeHandle<Object> JsonStringifier::Stringify(Handle<Object> object,
   if (!gap->IsUndefined(isolate_) && !InitializeGap(gap)) {
     return MaybeHandle<Object>();
   }
+  // Allocated in the outermost handle scope, since plans are cached from
+  // within nested ones. A primitive only reaches objects through toJSON or
+  // the replacer, which is too rare to be worth the allocation.
+  plan_cache_ = object->IsJSReceiver()
+                    ? factory()->NewFixedArray(2 * kPlanCacheSize)
+                    : factory()->empty_fixed_array();
   Result result = SerializeObject(object);
   if (result == UNCHANGED) return factory()->undefined_value();
   if (result == SUCCESS) return builder_.Finish();
@@ -765,20 +892,19 @@ JsonStringifier::Result JsonStringifier::SerializeJSObject(
     DCHECK(!object->HasIndexedInterceptor());
     DCHECK(!object->HasNamedInterceptor());
     Handle<Map> map(object->map(), isolate_);
+    Handle<FixedArray> plan = GetSerializationPlan(map);
     builder_.AppendCharacter('{');
     Indent();
     bool comma = false;
-    for (int i = 0; i < map->NumberOfOwnDescriptors(); i++) {
-      Handle<Name> name(map->instance_descriptors().GetKey(i), isolate_);
-      // TODO(rossberg): Should this throw?
-      if (!name->IsString()) continue;
-      Handle<String> key = Handle<String>::cast(name);
-      PropertyDetails details = map->instance_descriptors().GetDetails(i);
-      if (details.IsDontEnum()) continue;
+    for (int i = 0; i < plan->length(); i += kPlanEntrySize) {
+      Handle<String> key(String::cast(plan->get(i + kPlanKeyOffset)),
+                         isolate_);
+      PropertyDetails details(Smi::cast(plan->get(i + kPlanDetailsOffset)));
       Handle<Object> property;
       if (details.location() == kField && *map == object->map()) {
         DCHECK_EQ(kData, details.kind());
-        FieldIndex field_index = FieldIndex::ForDescriptor(*map, i);
+        FieldIndex field_index = FieldIndex::ForPropertyIndex(
+            *map, details.field_index(), details.representation());
         property = JSObject::FastPropertyAt(object, details.representation(),
                                             field_index);
       } else {
@@ -786,7 +912,16 @@ JsonStringifier::Result JsonStringifier::SerializeJSObject(
             isolate_, property,
             Object::GetPropertyOrElement(isolate_, object, key), EXCEPTION);
       }
-      Result result = SerializeProperty(property, comma, key);
+      Result result;
+      if (plan->get(i + kPlanIsPlainKeyOffset) == Smi::FromInt(1) &&
+          replacer_function_.is_null() && IsPlainValue(*property)) {
+        // Neither toJSON nor a replacer can run, so the value is known to be
+        // serialized and the key can be written out directly.
+        SerializePlainKey(comma, key);
+        result = Serialize_<false>(property, false, key);
+      } else {
+        result = SerializeProperty(property, comma, key);
+      }
       if (!comma && result == SUCCESS) comma = true;
       if (result == EXCEPTION) return result;
     }
@@ -1001,6 +1136,95 @@ bool JsonStringifier::DoNotEscape(uint16_t c) {
   return c >= 0x23 && c != 0x5C && c != 0x7F && (c < 0xD800 || c > 0xDFFF);
 }
 
+Handle<FixedArray> JsonStringifier::GetSerializationPlan(Handle<Map> map) {
+  DCHECK(!map->is_dictionary_map());
+  bool use_cache = plan_cache_->length() != 0;
+  int index = 2 * static_cast<int>((map->ptr() >> kTaggedSizeLog2) &
+                                   (kPlanCacheSize - 1));
+  if (use_cache && plan_cache_->get(index) == *map) {
+    return handle(FixedArray::cast(plan_cache_->get(index + 1)), isolate_);
+  }
+
+  DescriptorArray descriptors = map->instance_descriptors();
+  int count = 0;
+  for (int i = 0; i < map->NumberOfOwnDescriptors(); i++) {
+    // TODO(rossberg): Should this throw?
+    if (!descriptors.GetKey(i).IsString()) continue;
+    if (descriptors.GetDetails(i).IsDontEnum()) continue;
+    count++;
+  }
+  Handle<FixedArray> plan = factory()->NewFixedArray(count * kPlanEntrySize);
+  DisallowHeapAllocation no_gc;
+  descriptors = map->instance_descriptors();
+  int entry = 0;
+  for (int i = 0; i < map->NumberOfOwnDescriptors(); i++) {
+    Name name = descriptors.GetKey(i);
+    PropertyDetails details = descriptors.GetDetails(i);
+    if (!name.IsString() || details.IsDontEnum()) continue;
+    String key = String::cast(name);
+    plan->set(entry + kPlanKeyOffset, key);
+    plan->set(entry + kPlanDetailsOffset, details.AsSmi());
+    plan->set(entry + kPlanIsPlainKeyOffset,
+              Smi::FromInt(IsPlainKey(key) ? 1 : 0));
+    entry += kPlanEntrySize;
+  }
+  DCHECK_EQ(plan->length(), entry);
+  if (use_cache) {
+    plan_cache_->set(index, *map);
+    plan_cache_->set(index + 1, *plan);
+  }
+  return plan;
+}
+
+// static
+bool JsonStringifier::IsPlainKey(String key) {
+  DisallowHeapAllocation no_gc;
+  if (!key.IsOneByteRepresentation()) return false;
+  String::FlatContent flat = key.GetFlatContent(no_gc);
+  if (!flat.IsFlat()) return false;
+  for (uint8_t c : flat.ToOneByteVector()) {
+    if (!DoNotEscape(c)) return false;
+  }
+  return true;
+}
+
+// static
+bool JsonStringifier::IsPlainValue(Object value) {
+  if (value.IsSmi() || value.IsHeapNumber() || value.IsString()) return true;
+  if (!value.IsOddball()) return false;
+  byte kind = Oddball::cast(value).kind();
+  return kind == Oddball::kTrue || kind == Oddball::kFalse ||
+         kind == Oddball::kNull;
+}
+
+void JsonStringifier::SerializePlainKey(bool comma, Handle<String> key) {
+  Separator(!comma);
+  // The quotes and the colon.
+  if (builder_.CurrentPartCanFit(key->length() + 3)) {
+    if (builder_.CurrentEncoding() == String::ONE_BYTE_ENCODING) {
+      AppendPlainKey<uint8_t>(*key);
+    } else {
+      AppendPlainKey<uc16>(*key);
+    }
+  } else {
+    SerializeString(key);
+    builder_.AppendCharacter(':');
+  }
+  if (gap_ != nullptr) builder_.AppendCharacter(' ');
+}
+
+template <typename DestChar>
+void JsonStringifier::AppendPlainKey(String key) {
+  DisallowHeapAllocation no_gc;
+  Vector<const uint8_t> chars = key.GetFlatContent(no_gc).ToOneByteVector();
+  IncrementalStringBuilder::NoExtendBuilder<DestChar> no_extend(
+      &builder_, chars.length() + 3, no_gc);
+  no_extend.Append('"');
+  for (uint8_t c : chars) no_extend.Append(c);
+  no_extend.Append('"');
+  no_extend.Append(':');
+}
+
 void JsonStringifier::NewLine() {
   if (gap_ == nullptr) return;
   builder_.AppendCharacter('\n');
@@ -14,6 +14,13 @@ V8_WARN_UNUSED_RESULT MaybeHandle<Object> JsonStringify(Isolate* isolate,
                                                         Handle<Object> object,
                                                         Handle<Object> replacer,
                                                         Handle<Object> gap);
+
+// Like JsonStringify, but writes the result to {sink} as UTF-8 in chunks
+// instead of creating a string. Returns false if {object} has no JSON
+// representation, in which case nothing is written.
+V8_WARN_UNUSED_RESULT Maybe<bool> JsonStringifyToSink(
+    Isolate* isolate, Handle<Object> object, Handle<Object> gap,
+    v8::JSON::Utf8Sink* sink);
 }  // namespace internal
 }  // namespace v8
 
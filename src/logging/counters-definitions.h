@@ -324,12 +324,16 @@ namespace internal {
   /* Total count of functions compiled using the baseline compiler. */         \
   SC(total_baseline_compile_count, V8.TotalBaselineCompileCount)
 
-#define STATS_COUNTER_TS_LIST(SC)                                    \
-  SC(wasm_generated_code_size, V8.WasmGeneratedCodeBytes)            \
-  SC(wasm_reloc_size, V8.WasmRelocBytes)                             \
-  SC(wasm_lazily_compiled_functions, V8.WasmLazilyCompiledFunctions) \
-  SC(liftoff_compiled_functions, V8.LiftoffCompiledFunctions)        \
-  SC(liftoff_unsupported_functions, V8.LiftoffUnsupportedFunctions)
+#define STATS_COUNTER_TS_LIST(SC)                                            \
+  SC(wasm_generated_code_size, V8.WasmGeneratedCodeBytes)                    \
+  SC(wasm_reloc_size, V8.WasmRelocBytes)                                     \
+  SC(wasm_lazily_compiled_functions, V8.WasmLazilyCompiledFunctions)         \
+  SC(wasm_lazily_deserialized_functions, V8.WasmLazilyDeserializedFunctions) \
+  SC(liftoff_compiled_functions, V8.LiftoffCompiledFunctions)                \
+  SC(liftoff_unsupported_functions, V8.LiftoffUnsupportedFunctions)          \
+  /* Optimized wasm code evicted by code aging (--wasm-code-aging). */       \
+  SC(wasm_evicted_functions, V8.WasmEvictedFunctions)                        \
+  SC(wasm_evicted_code_size, V8.WasmEvictedCodeBytes)
 
 // List of counters that can be incremented from generated code. We need them in
 // a separate list to be able to relocate them.
@@ -895,6 +895,10 @@ void BytecodeArray::MakeOlder() {
   DCHECK_LE(bytecode_age(), kLastBytecodeAge);
 }
 
+bool BytecodeArray::IsCold() const {
+  return bytecode_age() >= kIsColdBytecodeAge;
+}
+
 bool BytecodeArray::IsOld() const {
   return bytecode_age() >= kIsOldBytecodeAge;
 }
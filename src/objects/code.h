@@ -726,6 +726,7 @@ class BytecodeArray : public FixedArrayBase {
     kFirstBytecodeAge = kNoAgeBytecodeAge,
     kLastBytecodeAge = kAfterLastBytecodeAge - 1,
     kBytecodeAgeCount = kAfterLastBytecodeAge - kFirstBytecodeAge - 1,
+    kIsColdBytecodeAge = kQuadragenarianBytecodeAge,
     kIsOldBytecodeAge = kSexagenarianBytecodeAge
   };
 
@@ -818,6 +819,7 @@ class BytecodeArray : public FixedArrayBase {
   void CopyBytecodesTo(BytecodeArray to);
 
   // Bytecode aging
+  V8_EXPORT_PRIVATE bool IsCold() const;
   V8_EXPORT_PRIVATE bool IsOld() const;
   V8_EXPORT_PRIVATE void MakeOlder();
 
@@ -38,6 +38,7 @@ int JSRegExp::CaptureCount() {
     case ATOM:
       return 0;
     case IRREGEXP:
+    case EXPERIMENTAL:
       return Smi::ToInt(DataAt(kIrregexpCaptureCountIndex));
     default:
       UNREACHABLE();
@@ -60,7 +61,7 @@ String JSRegExp::Pattern() {
 
 Object JSRegExp::CaptureNameMap() {
   DCHECK(this->data().IsFixedArray());
-  DCHECK_EQ(TypeTag(), IRREGEXP);
+  DCHECK(TypeSupportsCaptures(TypeTag()));
   Object value = DataAt(kIrregexpCaptureNameMapIndex);
   DCHECK_NE(value, Smi::FromInt(JSRegExp::kUninitializedValue));
   return value;
@@ -82,21 +83,51 @@ bool JSRegExp::HasCompiledCode() const {
   if (TypeTag() != IRREGEXP) return false;
 #ifdef DEBUG
   DCHECK(DataAt(kIrregexpLatin1CodeIndex).IsCode() ||
-         DataAt(kIrregexpLatin1CodeIndex).IsByteArray() ||
          DataAt(kIrregexpLatin1CodeIndex) == Smi::FromInt(kUninitializedValue));
   DCHECK(DataAt(kIrregexpUC16CodeIndex).IsCode() ||
-         DataAt(kIrregexpUC16CodeIndex).IsByteArray() ||
          DataAt(kIrregexpUC16CodeIndex) == Smi::FromInt(kUninitializedValue));
+  DCHECK(DataAt(kIrregexpLatin1BytecodeIndex).IsByteArray() ||
+         DataAt(kIrregexpLatin1BytecodeIndex) ==
+             Smi::FromInt(kUninitializedValue));
+  DCHECK(DataAt(kIrregexpUC16BytecodeIndex).IsByteArray() ||
+         DataAt(kIrregexpUC16BytecodeIndex) ==
+             Smi::FromInt(kUninitializedValue));
 #endif  // DEBUG
   Smi uninitialized = Smi::FromInt(kUninitializedValue);
   return (DataAt(kIrregexpLatin1CodeIndex) != uninitialized ||
-          DataAt(kIrregexpUC16CodeIndex) != uninitialized);
+          DataAt(kIrregexpUC16CodeIndex) != uninitialized ||
+          DataAt(kIrregexpLatin1BytecodeIndex) != uninitialized ||
+          DataAt(kIrregexpUC16BytecodeIndex) != uninitialized);
 }
 
 void JSRegExp::DiscardCompiledCodeForSerialization() {
   DCHECK(HasCompiledCode());
   SetDataAt(kIrregexpLatin1CodeIndex, Smi::FromInt(kUninitializedValue));
   SetDataAt(kIrregexpUC16CodeIndex, Smi::FromInt(kUninitializedValue));
+  SetDataAt(kIrregexpLatin1BytecodeIndex, Smi::FromInt(kUninitializedValue));
+  SetDataAt(kIrregexpUC16BytecodeIndex, Smi::FromInt(kUninitializedValue));
+}
+
+bool JSRegExp::ShouldProduceBytecode() {
+  return FLAG_regexp_interpret_all ||
+         (FLAG_regexp_tier_up && !MarkedForTierUp());
+}
+
+bool JSRegExp::MarkedForTierUp() {
+  DCHECK_EQ(TypeTag(), IRREGEXP);
+  return Smi::ToInt(DataAt(kIrregexpTicksUntilTierUpIndex)) == 0;
+}
+
+void JSRegExp::TierUpTick() {
+  DCHECK_EQ(TypeTag(), IRREGEXP);
+  int ticks = Smi::ToInt(DataAt(kIrregexpTicksUntilTierUpIndex));
+  if (ticks == 0) return;
+  SetDataAt(kIrregexpTicksUntilTierUpIndex, Smi::FromInt(ticks - 1));
+}
+
+void JSRegExp::MarkTierUpForNextExec() {
+  DCHECK_EQ(TypeTag(), IRREGEXP);
+  SetDataAt(kIrregexpTicksUntilTierUpIndex, Smi::kZero);
 }
 
 }  // namespace internal
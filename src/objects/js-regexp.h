@@ -35,7 +35,9 @@ class JSRegExp : public JSObject {
   // NOT_COMPILED: Initial value. No data has been stored in the JSRegExp yet.
   // ATOM: A simple string to match against using an indexOf operation.
   // IRREGEXP: Compiled with Irregexp.
-  enum Type { NOT_COMPILED, ATOM, IRREGEXP };
+  // EXPERIMENTAL: Compiled to bytecode for the linear-time experimental
+  //               engine. Uses the same data layout as IRREGEXP.
+  enum Type { NOT_COMPILED, ATOM, IRREGEXP, EXPERIMENTAL };
   struct FlagShiftBit {
     static constexpr int kGlobal = 0;
     static constexpr int kIgnoreCase = 1;
@@ -99,6 +101,9 @@ class JSRegExp : public JSObject {
                                           Handle<String> flags_string);
 
   inline Type TypeTag() const;
+  static bool TypeSupportsCaptures(Type t) {
+    return t == IRREGEXP || t == EXPERIMENTAL;
+  }
   // Number of captures (without the match itself).
   inline int CaptureCount();
   inline Flags GetFlags();
@@ -116,9 +121,25 @@ class JSRegExp : public JSObject {
     }
   }
 
+  static int bytecode_index(bool is_one_byte) {
+    if (is_one_byte) {
+      return kIrregexpLatin1BytecodeIndex;
+    } else {
+      return kIrregexpUC16BytecodeIndex;
+    }
+  }
+
   inline bool HasCompiledCode() const;
   inline void DiscardCompiledCodeForSerialization();
 
+  // Irregexp tier-up (see --regexp-tier-up). A regexp produces bytecode for
+  // the interpreter until it was executed often enough or it was matched
+  // against a long subject, and native code afterwards.
+  inline bool ShouldProduceBytecode();
+  inline bool MarkedForTierUp();
+  inline void TierUpTick();
+  inline void MarkTierUpForNextExec();
+
   DECL_CAST(JSRegExp)
 
   // Dispatched behavior.
@@ -144,11 +165,11 @@ class JSRegExp : public JSObject {
 
   static const int kAtomDataSize = kAtomPatternIndex + 1;
 
-  // Irregexp compiled code or bytecode for Latin1. If compilation
+  // Irregexp compiled code for Latin1. If compilation
   // fails, this fields hold an exception object that should be
   // thrown if the regexp is used again.
   static const int kIrregexpLatin1CodeIndex = kDataIndex;
-  // Irregexp compiled code or bytecode for UC16.  If compilation
+  // Irregexp compiled code for UC16.  If compilation
   // fails, this fields hold an exception object that should be
   // thrown if the regexp is used again.
   static const int kIrregexpUC16CodeIndex = kDataIndex + 1;
@@ -160,8 +181,20 @@ class JSRegExp : public JSObject {
   // Maps names of named capture groups (at indices 2i) to their corresponding
   // (1-based) capture group indices (at indices 2i + 1).
   static const int kIrregexpCaptureNameMapIndex = kDataIndex + 4;
-
-  static const int kIrregexpDataSize = kIrregexpCaptureNameMapIndex + 1;
+  // Irregexp bytecode for the interpreter, for Latin1 and UC16 subjects. The
+  // Latin1 slot holds the bytecode of EXPERIMENTAL regexps, which works for
+  // both.
+  static const int kIrregexpLatin1BytecodeIndex = kDataIndex + 5;
+  static const int kIrregexpUC16BytecodeIndex = kDataIndex + 6;
+  // Number of interpreted executions left before the regexp tiers up to
+  // native code. Zero once the regexp is marked for tier-up.
+  static const int kIrregexpTicksUntilTierUpIndex = kDataIndex + 7;
+  // String that every match starts with, used to skip ahead to candidate
+  // match positions (see --regexp-prefix-scan). kUninitializedValue if the
+  // regexp has no literal prefix.
+  static const int kIrregexpLiteralPrefixIndex = kDataIndex + 8;
+
+  static const int kIrregexpDataSize = kIrregexpLiteralPrefixIndex + 1;
 
   // In-object fields.
   static const int kLastIndexFieldIndex = 0;
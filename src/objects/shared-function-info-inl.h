@@ -511,6 +511,20 @@ bool SharedFunctionInfo::ShouldFlushBytecode(BytecodeFlushMode mode) {
   return bytecode.IsOld();
 }
 
+bool SharedFunctionInfo::ShouldTrimColdBytecode() {
+  // Source positions are recollected by reparsing the function, so only trim
+  // functions that could also be flushed.
+  if (IsResumableFunction(kind()) || !allows_lazy_compilation()) {
+    return false;
+  }
+
+  Object data = function_data();
+  if (!data.IsBytecodeArray()) return false;
+
+  BytecodeArray bytecode = BytecodeArray::cast(data);
+  return bytecode.IsCold() && bytecode.HasSourcePositionTable();
+}
+
 Code SharedFunctionInfo::InterpreterTrampoline() const {
   DCHECK(HasInterpreterData());
   return interpreter_data().interpreter_trampoline();
@@ -561,6 +561,12 @@ class SharedFunctionInfo : public HeapObject {
   // Hence it takes the mode as an argument.
   inline bool ShouldFlushBytecode(BytecodeFlushMode mode);
 
+  // Returns true if the function has cold bytecode whose source position
+  // table could be discarded. Old bytecode is flushed instead when bytecode
+  // flushing is enabled. Like ShouldFlushBytecode, this is used by the
+  // concurrent marker and doesn't access any flags.
+  inline bool ShouldTrimColdBytecode();
+
   // Check whether or not this function is inlineable.
   bool IsInlineable();
 
@@ -34,6 +34,18 @@ void LiteralBuffer::ExpandBuffer() {
   backing_store_ = new_store;
 }
 
+void LiteralBuffer::AddAsciiChars(const uint16_t* begin, const uint16_t* end) {
+  DCHECK_LE(begin, end);
+  if (!is_one_byte()) {
+    for (const uint16_t* c = begin; c < end; ++c) AddTwoByteChar(*c);
+    return;
+  }
+  int length = static_cast<int>(end - begin);
+  while (position_ + length > backing_store_.length()) ExpandBuffer();
+  CopyChars(backing_store_.begin() + position_, begin, length);
+  position_ += length;
+}
+
 void LiteralBuffer::ConvertToTwoByte() {
   DCHECK(is_one_byte());
   Vector<byte> new_store;
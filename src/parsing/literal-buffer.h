@@ -34,6 +34,10 @@ class LiteralBuffer final {
     AddTwoByteChar(code_unit);
   }
 
+  // Adds a run of ASCII code units, e.g. one that the scanner skipped a word
+  // at a time.
+  void AddAsciiChars(const uint16_t* begin, const uint16_t* end);
+
   bool is_one_byte() const { return is_one_byte_; }
 
   bool Equals(Vector<const char> keyword) const {
@@ -2345,10 +2345,17 @@ FunctionLiteral* Parser::ParseFunctionLiteral(
 
   // If parallel compile tasks are enabled, and the function is an eager
   // top level function, then we can pre-parse the function and parse / compile
-  // in a parallel task on a worker thread.
+  // in a parallel task on a worker thread. Eager inner functions are compiled
+  // as part of that task. With --parallel-compile-tasks-for-lazy, lazy top
+  // level functions are posted too, so that functions called during top-level
+  // execution don't have to be compiled on the main thread. Only a bounded
+  // number of them is posted, since most lazy functions never run.
   bool should_post_parallel_task =
-      parse_lazily() && is_eager_top_level_function &&
-      FLAG_parallel_compile_tasks && info()->parallel_tasks() &&
+      parse_lazily() && FLAG_parallel_compile_tasks &&
+      info()->parallel_tasks() &&
+      (is_eager_top_level_function ||
+       (is_lazy_top_level_function && FLAG_parallel_compile_tasks_for_lazy &&
+        info()->parallel_tasks()->dispatcher()->CanEnqueueLazyJob())) &&
       scanner()->stream()->can_be_cloned_for_parallel_access();
 
   // This may be modified later to reflect preparsing decision taken
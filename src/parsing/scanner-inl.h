@@ -272,25 +272,45 @@ V8_INLINE Token::Value Scanner::ScanIdentifierOrKeywordInner() {
       // Otherwise we'll fall into the slow path after scanning the identifier.
       DCHECK(!IdentifierNeedsSlowPath(scan_flags));
       AddLiteralChar(static_cast<char>(c0_));
-      AdvanceUntil([this, &scan_flags](uc32 c0) {
-        if (V8_UNLIKELY(static_cast<uint32_t>(c0) > kMaxAscii)) {
-          // A non-ascii character means we need to drop through to the slow
-          // path.
-          // TODO(leszeks): This would be most efficient as a goto to the slow
-          // path, check codegen and maybe use a bool instead.
-          scan_flags |=
-              static_cast<uint8_t>(ScanFlags::kIdentifierNeedsSlowPath);
-          return true;
-        }
-        uint8_t char_flags = character_scan_flags[c0];
-        scan_flags |= char_flags;
-        if (TerminatesLiteral(char_flags)) {
-          return true;
-        } else {
-          AddLiteralChar(static_cast<char>(c0));
-          return false;
-        }
-      });
+      SkipWordsAndAdvanceUntil(
+          [&scan_flags](uint64_t word) {
+            uint64_t lower = ascii_word::InRange(word, 'a', 'z');
+            if (!ascii_word::All(lower | ascii_word::InRange(word, 'A', 'Z') |
+                                 ascii_word::InRange(word, '0', '9') |
+                                 ascii_word::Equal(word, '_') |
+                                 ascii_word::Equal(word, '$'))) {
+              return false;
+            }
+            // Keywords only contain lower case letters. Some lower case
+            // letters can't be part of a keyword either, but the keyword
+            // lookup below sorts those out.
+            if (!ascii_word::All(lower)) {
+              scan_flags |= static_cast<uint8_t>(ScanFlags::kCannotBeKeyword);
+            }
+            return true;
+          },
+          [this](const uint16_t* begin, const uint16_t* end) {
+            next().literal_chars.AddAsciiChars(begin, end);
+          },
+          [this, &scan_flags](uc32 c0) {
+            if (V8_UNLIKELY(static_cast<uint32_t>(c0) > kMaxAscii)) {
+              // A non-ascii character means we need to drop through to the
+              // slow path.
+              // TODO(leszeks): This would be most efficient as a goto to the
+              // slow path, check codegen and maybe use a bool instead.
+              scan_flags |=
+                  static_cast<uint8_t>(ScanFlags::kIdentifierNeedsSlowPath);
+              return true;
+            }
+            uint8_t char_flags = character_scan_flags[c0];
+            scan_flags |= char_flags;
+            if (TerminatesLiteral(char_flags)) {
+              return true;
+            } else {
+              AddLiteralChar(static_cast<char>(c0));
+              return false;
+            }
+          });
 
       if (V8_LIKELY(!IdentifierNeedsSlowPath(scan_flags))) {
         if (!CanBeKeyword(scan_flags)) return Token::IDENTIFIER;
@@ -327,6 +347,11 @@ V8_INLINE Token::Value Scanner::SkipWhiteSpace() {
     if (!next().after_line_terminator && unibrow::IsLineTerminator(c0_)) {
       next().after_line_terminator = true;
     }
+    // Skip runs of indentation a word at a time.
+    source_->AdvanceWords([](uint64_t word) {
+      return ascii_word::All(ascii_word::Equal(word, ' ') |
+                             ascii_word::Equal(word, '\t'));
+    });
     Advance();
   }
 
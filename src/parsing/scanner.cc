@@ -202,7 +202,12 @@ Token::Value Scanner::SkipSingleLineComment() {
   // separately by the lexical grammar and becomes part of the
   // stream of input elements for the syntactic grammar (see
   // ECMA-262, section 7.4).
-  AdvanceUntil([](uc32 c0_) { return unibrow::IsLineTerminator(c0_); });
+  SkipWordsAndAdvanceUntil(
+      [](uint64_t word) {
+        return !(ascii_word::Equal(word, '\n') | ascii_word::Equal(word, '\r'));
+      },
+      [](const uint16_t* begin, const uint16_t* end) {},
+      [](uc32 c0_) { return unibrow::IsLineTerminator(c0_); });
 
   return Token::WHITESPACE;
 }
@@ -274,13 +279,20 @@ Token::Value Scanner::SkipMultiLineComment() {
   // Until we see the first newline, check for * and newline characters.
   if (!next().after_line_terminator) {
     do {
-      AdvanceUntil([](uc32 c0) {
-        if (V8_UNLIKELY(static_cast<uint32_t>(c0) > kMaxAscii)) {
-          return unibrow::IsLineTerminator(c0);
-        }
-        uint8_t char_flags = character_scan_flags[c0];
-        return MultilineCommentCharacterNeedsSlowPath(char_flags);
-      });
+      SkipWordsAndAdvanceUntil(
+          [](uint64_t word) {
+            return !(ascii_word::Equal(word, '*') |
+                     ascii_word::Equal(word, '\n') |
+                     ascii_word::Equal(word, '\r'));
+          },
+          [](const uint16_t* begin, const uint16_t* end) {},
+          [](uc32 c0) {
+            if (V8_UNLIKELY(static_cast<uint32_t>(c0) > kMaxAscii)) {
+              return unibrow::IsLineTerminator(c0);
+            }
+            uint8_t char_flags = character_scan_flags[c0];
+            return MultilineCommentCharacterNeedsSlowPath(char_flags);
+          });
 
       while (c0_ == '*') {
         Advance();
@@ -299,7 +311,10 @@ Token::Value Scanner::SkipMultiLineComment() {
 
   // After we've seen newline, simply try to find '*/'.
   while (c0_ != kEndOfInput) {
-    AdvanceUntil([](uc32 c0) { return c0 == '*'; });
+    SkipWordsAndAdvanceUntil(
+        [](uint64_t word) { return !ascii_word::Equal(word, '*'); },
+        [](const uint16_t* begin, const uint16_t* end) {},
+        [](uc32 c0) { return c0 == '*'; });
 
     while (c0_ == '*') {
       Advance();
@@ -451,19 +466,30 @@ Token::Value Scanner::ScanString() {
 
   next().literal_chars.Start();
   while (true) {
-    AdvanceUntil([this](uc32 c0) {
-      if (V8_UNLIKELY(static_cast<uint32_t>(c0) > kMaxAscii)) {
-        if (V8_UNLIKELY(unibrow::IsStringLiteralLineTerminator(c0))) {
-          return true;
-        }
-        AddLiteralChar(c0);
-        return false;
-      }
-      uint8_t char_flags = character_scan_flags[c0];
-      if (MayTerminateString(char_flags)) return true;
-      AddLiteralChar(c0);
-      return false;
-    });
+    SkipWordsAndAdvanceUntil(
+        [](uint64_t word) {
+          return !(ascii_word::Equal(word, '\'') |
+                   ascii_word::Equal(word, '"') |
+                   ascii_word::Equal(word, '\\') |
+                   ascii_word::Equal(word, '\n') |
+                   ascii_word::Equal(word, '\r'));
+        },
+        [this](const uint16_t* begin, const uint16_t* end) {
+          next().literal_chars.AddAsciiChars(begin, end);
+        },
+        [this](uc32 c0) {
+          if (V8_UNLIKELY(static_cast<uint32_t>(c0) > kMaxAscii)) {
+            if (V8_UNLIKELY(unibrow::IsStringLiteralLineTerminator(c0))) {
+              return true;
+            }
+            AddLiteralChar(c0);
+            return false;
+          }
+          uint8_t char_flags = character_scan_flags[c0];
+          if (MayTerminateString(char_flags)) return true;
+          AddLiteralChar(c0);
+          return false;
+        });
 
     while (c0_ == '\\') {
       Advance();
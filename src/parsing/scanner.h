@@ -8,6 +8,7 @@
 #define V8_PARSING_SCANNER_H_
 
 #include <algorithm>
+#include <cstring>
 
 #include "src/base/logging.h"
 #include "src/common/globals.h"
@@ -30,6 +31,50 @@ class ParserRecorder;
 class RuntimeCallStats;
 class Zone;
 
+// ---------------------------------------------------------------------
+// Helpers for looking at four UTF-16 code units at once, loaded into one
+// 64-bit word. Apart from IsAscii, they require every code unit in the word to
+// be ASCII and return a mask with the top bit of each matching code unit set.
+// The checks are exact per code unit; no borrow crosses into a neighbour.
+namespace ascii_word {
+
+constexpr int kCodeUnits = sizeof(uint64_t) / sizeof(uint16_t);
+constexpr uint64_t kOnes = uint64_t{0x0001000100010001};
+constexpr uint64_t kHighBits = kOnes << 15;
+constexpr uint64_t kLowBits = ~kHighBits;
+
+V8_INLINE uint64_t Load(const uint16_t* code_units) {
+  uint64_t word;
+  memcpy(&word, code_units, sizeof(word));
+  return word;
+}
+
+V8_INLINE bool IsAscii(uint64_t word) {
+  return (word & (kOnes * 0xFF80)) == 0;
+}
+
+V8_INLINE bool All(uint64_t mask) { return mask == kHighBits; }
+
+V8_INLINE uint64_t Zero(uint64_t word) {
+  return ~(((word & kLowBits) + kLowBits) | word) & kHighBits;
+}
+
+V8_INLINE uint64_t Equal(uint64_t word, char c) {
+  return Zero(word ^ (kOnes * static_cast<uint8_t>(c)));
+}
+
+V8_INLINE uint64_t GreaterOrEqual(uint64_t word, char c) {
+  return ((word | kHighBits) - kOnes * static_cast<uint8_t>(c)) & kHighBits;
+}
+
+V8_INLINE uint64_t InRange(uint64_t word, char lo, char hi) {
+  DCHECK_LE(lo, hi);
+  return GreaterOrEqual(word, lo) &
+         ~GreaterOrEqual(word, static_cast<char>(hi + 1));
+}
+
+}  // namespace ascii_word
+
 // ---------------------------------------------------------------------
 // Buffered stream of UTF-16 code units, using an internal UTF-16 buffer.
 // A code unit is a 16 bit value representing either a 16 bit code point
@@ -90,6 +135,52 @@ class Utf16CharacterStream {
     }
   }
 
+  // Like AdvanceUntil, but first skips whole groups of
+  // ascii_word::kCodeUnits ASCII code units for which |can_skip_word| returns
+  // true, without calling |check| on each of them. Every skipped run is passed
+  // to |on_skip| as a [begin, end) range. The group that stops the fast path,
+  // e.g. because it contains non-ASCII code units, is checked one code unit at
+  // a time, so two-byte input behaves exactly as with AdvanceUntil.
+  template <typename WordFunction, typename SkipFunction,
+            typename FunctionType>
+  V8_INLINE uc32 SkipWordsAndAdvanceUntil(WordFunction can_skip_word,
+                                          SkipFunction on_skip,
+                                          FunctionType check) {
+    while (true) {
+      const uint16_t* cursor = SkipWords(can_skip_word);
+      if (cursor != buffer_cursor_) {
+        on_skip(buffer_cursor_, cursor);
+        buffer_cursor_ = cursor;
+      }
+
+      const uint16_t* group_end =
+          cursor + std::min<ptrdiff_t>(ascii_word::kCodeUnits,
+                                       buffer_end_ - cursor);
+      auto next_cursor_pos =
+          std::find_if(cursor, group_end, [&check](uint16_t raw_c0_) {
+            uc32 c0_ = static_cast<uc32>(raw_c0_);
+            return check(c0_);
+          });
+
+      if (next_cursor_pos != group_end) {
+        buffer_cursor_ = next_cursor_pos + 1;
+        return static_cast<uc32>(*next_cursor_pos);
+      }
+      buffer_cursor_ = group_end;
+      if (group_end == buffer_end_ && !ReadBlockChecked()) {
+        buffer_cursor_++;
+        return kEndOfInput;
+      }
+    }
+  }
+
+  // Advances past whole groups of ASCII code units for which |can_skip_word|
+  // returns true.
+  template <typename WordFunction>
+  V8_INLINE void AdvanceWords(WordFunction can_skip_word) {
+    buffer_cursor_ = SkipWords(can_skip_word);
+  }
+
   // Go back one by one character in the input stream.
   // This undoes the most recent Advance().
   inline void Back() {
@@ -147,6 +238,19 @@ class Utf16CharacterStream {
         buffer_pos_(buffer_pos) {}
   Utf16CharacterStream() : Utf16CharacterStream(nullptr, nullptr, nullptr, 0) {}
 
+  // Returns the end of the run of skippable ASCII groups at the cursor. Only
+  // looks at the current buffer.
+  template <typename WordFunction>
+  V8_INLINE const uint16_t* SkipWords(WordFunction can_skip_word) const {
+    const uint16_t* cursor = buffer_cursor_;
+    while (buffer_end_ - cursor >= ascii_word::kCodeUnits) {
+      uint64_t word = ascii_word::Load(cursor);
+      if (!ascii_word::IsAscii(word) || !can_skip_word(word)) break;
+      cursor += ascii_word::kCodeUnits;
+    }
+    return cursor;
+  }
+
   bool ReadBlockChecked() {
     size_t position = pos();
     USE(position);
@@ -530,6 +634,14 @@ class V8_EXPORT_PRIVATE Scanner {
     c0_ = source_->AdvanceUntil(check);
   }
 
+  template <typename WordFunction, typename SkipFunction,
+            typename FunctionType>
+  V8_INLINE void SkipWordsAndAdvanceUntil(WordFunction can_skip_word,
+                                          SkipFunction on_skip,
+                                          FunctionType check) {
+    c0_ = source_->SkipWordsAndAdvanceUntil(can_skip_word, on_skip, check);
+  }
+
   bool CombineSurrogatePair() {
     DCHECK(!unibrow::Utf16::IsLeadSurrogate(kEndOfInput));
     if (unibrow::Utf16::IsLeadSurrogate(c0_)) {
@@ -0,0 +1,121 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_REGEXP_EXPERIMENTAL_EXPERIMENTAL_BYTECODE_H_
+#define V8_REGEXP_EXPERIMENTAL_EXPERIMENTAL_BYTECODE_H_
+
+#include "src/regexp/regexp-ast.h"
+
+// Bytecode format for the experimental regexp engine, a Thompson NFA
+// simulated by a Pike VM (see experimental-interpreter.h). Threads executing
+// the bytecode have a program counter and a set of capture registers.
+//
+// CONSUME_RANGE: Check whether the current input character is in the range
+//   [min, max]. If so, advance the thread to the next instruction and the
+//   next input character, otherwise kill the thread.
+// ASSERTION: Check a zero-width assertion (e.g. ^, $, \b) at the current
+//   input position and kill the thread if it fails.
+// FORK: Create a copy of the thread starting at instruction {pc}. The copy
+//   has lower priority than the current thread, which continues with the
+//   next instruction.
+// JMP: Continue at instruction {pc}.
+// SET_REGISTER_TO_CP: Set register {register_index} to the current input
+//   position.
+// CLEAR_REGISTER: Set register {register_index} to -1.
+// ACCEPT: The thread found a match.
+
+namespace v8 {
+namespace internal {
+
+struct RegExpInstruction {
+  enum Opcode : int32_t {
+    ACCEPT,
+    ASSERTION,
+    CLEAR_REGISTER,
+    CONSUME_RANGE,
+    FORK,
+    JMP,
+    SET_REGISTER_TO_CP,
+  };
+
+  struct Uc16Range {
+    uc16 min;  // Inclusive.
+    uc16 max;  // Inclusive.
+  };
+
+  static RegExpInstruction ConsumeRange(Uc16Range range) {
+    RegExpInstruction result;
+    result.opcode = CONSUME_RANGE;
+    result.payload.consume_range = range;
+    return result;
+  }
+
+  // Never matches, since the range is empty.
+  static RegExpInstruction Fail() {
+    return ConsumeRange(Uc16Range{0xFFFF, 0x0000});
+  }
+
+  static RegExpInstruction Assertion(RegExpAssertion::AssertionType type) {
+    RegExpInstruction result;
+    result.opcode = ASSERTION;
+    result.payload.assertion_type = type;
+    return result;
+  }
+
+  static RegExpInstruction Fork(int32_t pc) {
+    RegExpInstruction result;
+    result.opcode = FORK;
+    result.payload.pc = pc;
+    return result;
+  }
+
+  static RegExpInstruction Jmp(int32_t pc) {
+    RegExpInstruction result;
+    result.opcode = JMP;
+    result.payload.pc = pc;
+    return result;
+  }
+
+  static RegExpInstruction SetRegisterToCp(int32_t register_index) {
+    RegExpInstruction result;
+    result.opcode = SET_REGISTER_TO_CP;
+    result.payload.register_index = register_index;
+    return result;
+  }
+
+  static RegExpInstruction ClearRegister(int32_t register_index) {
+    RegExpInstruction result;
+    result.opcode = CLEAR_REGISTER;
+    result.payload.register_index = register_index;
+    return result;
+  }
+
+  static RegExpInstruction Accept() {
+    RegExpInstruction result;
+    result.opcode = ACCEPT;
+    return result;
+  }
+
+  Opcode opcode;
+  union {
+    // Payload of CONSUME_RANGE:
+    Uc16Range consume_range;
+    // Payload of FORK and JMP, the next/forked program counter (pc):
+    int32_t pc;
+    // Payload of SET_REGISTER_TO_CP and CLEAR_REGISTER:
+    int32_t register_index;
+    // Payload of ASSERTION:
+    RegExpAssertion::AssertionType assertion_type;
+  } payload;
+  STATIC_ASSERT(sizeof(payload) == 4);
+};
+STATIC_ASSERT(sizeof(RegExpInstruction) == 8);
+// The regexp compiler emits bytecode into a ByteArray, which is why
+// instructions need to be trivially copyable.
+ASSERT_TRIVIALLY_COPYABLE(RegExpInstruction);
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_REGEXP_EXPERIMENTAL_EXPERIMENTAL_BYTECODE_H_
@@ -0,0 +1,371 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/regexp/experimental/experimental-compiler.h"
+
+#include "src/regexp/regexp-compiler.h"
+#include "src/zone/zone-list-inl.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+// Returns whether a regexp can be compiled to experimental bytecode.
+class CanBeHandledVisitor final : private RegExpVisitor {
+ public:
+  static bool Check(RegExpTree* tree, JSRegExp::Flags flags) {
+    if (!AreSuitableFlags(flags)) return false;
+    CanBeHandledVisitor visitor;
+    tree->Accept(&visitor, nullptr);
+    return visitor.result_;
+  }
+
+ private:
+  CanBeHandledVisitor() = default;
+
+  static bool AreSuitableFlags(JSRegExp::Flags flags) {
+    // Matching with these flags needs case folding and surrogate pair
+    // handling, which the experimental engine does not implement yet.
+    return !IgnoreCase(flags) && !IsUnicode(flags);
+  }
+
+  void* VisitDisjunction(RegExpDisjunction* node, void*) override {
+    for (RegExpTree* alternative : *node->alternatives()) {
+      alternative->Accept(this, nullptr);
+      if (!result_) return nullptr;
+    }
+    return nullptr;
+  }
+
+  void* VisitAlternative(RegExpAlternative* node, void*) override {
+    for (RegExpTree* child : *node->nodes()) {
+      child->Accept(this, nullptr);
+      if (!result_) return nullptr;
+    }
+    return nullptr;
+  }
+
+  void* VisitCharacterClass(RegExpCharacterClass* node, void*) override {
+    result_ = result_ && AreSuitableFlags(node->flags());
+    return nullptr;
+  }
+
+  void* VisitAssertion(RegExpAssertion* node, void*) override {
+    result_ = result_ && AreSuitableFlags(node->flags());
+    return nullptr;
+  }
+
+  void* VisitAtom(RegExpAtom* node, void*) override {
+    result_ = result_ && AreSuitableFlags(node->flags());
+    return nullptr;
+  }
+
+  void* VisitText(RegExpText* node, void*) override {
+    for (TextElement& element : *node->elements()) {
+      element.tree()->Accept(this, nullptr);
+      if (!result_) return nullptr;
+    }
+    return nullptr;
+  }
+
+  void* VisitQuantifier(RegExpQuantifier* node, void*) override {
+    // Possessive quantifiers are only used internally and would need
+    // backtracking semantics.
+    if (!node->is_greedy() && !node->is_non_greedy()) {
+      result_ = false;
+      return nullptr;
+    }
+    node->body()->Accept(this, nullptr);
+    return nullptr;
+  }
+
+  void* VisitCapture(RegExpCapture* node, void*) override {
+    node->body()->Accept(this, nullptr);
+    return nullptr;
+  }
+
+  void* VisitGroup(RegExpGroup* node, void*) override {
+    node->body()->Accept(this, nullptr);
+    return nullptr;
+  }
+
+  void* VisitLookaround(RegExpLookaround* node, void*) override {
+    result_ = false;
+    return nullptr;
+  }
+
+  void* VisitBackReference(RegExpBackReference* node, void*) override {
+    result_ = false;
+    return nullptr;
+  }
+
+  void* VisitEmpty(RegExpEmpty* node, void*) override { return nullptr; }
+
+  bool result_ = true;
+};
+
+// Emits the bytecode for a RegExpTree.
+class CompileVisitor final : private RegExpVisitor {
+ public:
+  static ZoneList<RegExpInstruction>* Compile(RegExpTree* tree, Zone* zone) {
+    CompileVisitor compiler(zone);
+
+    // The whole match is capture group 0.
+    compiler.Emit(RegExpInstruction::SetRegisterToCp(0));
+    tree->Accept(&compiler, nullptr);
+    compiler.Emit(RegExpInstruction::SetRegisterToCp(1));
+    compiler.Emit(RegExpInstruction::Accept());
+
+    if (compiler.too_large_) return nullptr;
+    return compiler.code_;
+  }
+
+ private:
+  explicit CompileVisitor(Zone* zone)
+      : zone_(zone), code_(new (zone) ZoneList<RegExpInstruction>(0, zone)) {}
+
+  int pc() const { return code_->length(); }
+
+  int Emit(RegExpInstruction instruction) {
+    if (code_->length() >= ExperimentalRegExpCompiler::kMaxInstructionCount) {
+      too_large_ = true;
+    } else {
+      code_->Add(instruction, zone_);
+    }
+    return code_->length() - 1;
+  }
+
+  // Sets the target of the FORK or JMP at {pc} to {target}.
+  void Patch(int pc, int target) {
+    if (too_large_) return;
+    DCHECK(code_->at(pc).opcode == RegExpInstruction::FORK ||
+           code_->at(pc).opcode == RegExpInstruction::JMP);
+    code_->at(pc).payload.pc = target;
+  }
+
+  // Emits a choice between the given alternatives, with decreasing priority:
+  //
+  //   FORK alt_2
+  //   <alt_1>
+  //   JMP end
+  // alt_2:
+  //   FORK alt_3
+  //   ...
+  //   <alt_n>
+  // end:
+  template <class F>
+  void CompileDisjunction(int alternative_count, F&& compile_alternative) {
+    if (alternative_count == 0) {
+      Emit(RegExpInstruction::Fail());
+      return;
+    }
+    std::vector<int> jmps_to_end;
+    for (int i = 0; i < alternative_count - 1; ++i) {
+      int fork = Emit(RegExpInstruction::Fork(-1));
+      compile_alternative(i);
+      jmps_to_end.push_back(Emit(RegExpInstruction::Jmp(-1)));
+      Patch(fork, pc());
+    }
+    compile_alternative(alternative_count - 1);
+    for (int jmp : jmps_to_end) Patch(jmp, pc());
+  }
+
+  void CompileCharacterRanges(ZoneList<CharacterRange>* ranges, bool negated) {
+    CharacterRange::Canonicalize(ranges);
+    if (negated) {
+      ZoneList<CharacterRange>* negated_ranges =
+          new (zone_) ZoneList<CharacterRange>(ranges->length() + 1, zone_);
+      CharacterRange::Negate(ranges, negated_ranges, zone_);
+      ranges = negated_ranges;
+    }
+    // Non-unicode regexps match UTF-16 code units, so ranges are clipped to
+    // the BMP.
+    int range_count = 0;
+    while (range_count < ranges->length() &&
+           ranges->at(range_count).from() <= kMaxUInt16) {
+      ++range_count;
+    }
+    CompileDisjunction(range_count, [&](int i) {
+      CharacterRange range = ranges->at(i);
+      RegExpInstruction::Uc16Range uc16_range;
+      uc16_range.min = static_cast<uc16>(range.from());
+      uc16_range.max = static_cast<uc16>(Min<uc32>(range.to(), kMaxUInt16));
+      Emit(RegExpInstruction::ConsumeRange(uc16_range));
+    });
+  }
+
+  // Captures inside a quantified body are reset at the start of each
+  // iteration.
+  void ClearCaptures(Interval indices) {
+    if (indices.is_empty()) return;
+    for (int i = indices.from(); i <= indices.to(); ++i) {
+      Emit(RegExpInstruction::ClearRegister(i));
+    }
+  }
+
+  void CompileGreedyStar(RegExpTree* body, Interval captures) {
+    // loop:
+    //   FORK end
+    //   <clear captures>
+    //   <body>
+    //   JMP loop
+    // end:
+    int loop = pc();
+    int fork = Emit(RegExpInstruction::Fork(-1));
+    ClearCaptures(captures);
+    body->Accept(this, nullptr);
+    Emit(RegExpInstruction::Jmp(loop));
+    Patch(fork, pc());
+  }
+
+  void CompileNonGreedyStar(RegExpTree* body, Interval captures) {
+    // loop:
+    //   FORK body
+    //   JMP end
+    // body:
+    //   <clear captures>
+    //   <body>
+    //   JMP loop
+    // end:
+    int loop = pc();
+    int fork = Emit(RegExpInstruction::Fork(-1));
+    int jmp = Emit(RegExpInstruction::Jmp(-1));
+    Patch(fork, pc());
+    ClearCaptures(captures);
+    body->Accept(this, nullptr);
+    Emit(RegExpInstruction::Jmp(loop));
+    Patch(jmp, pc());
+  }
+
+  void* VisitDisjunction(RegExpDisjunction* node, void*) override {
+    ZoneList<RegExpTree*>* alternatives = node->alternatives();
+    CompileDisjunction(alternatives->length(), [&](int i) {
+      alternatives->at(i)->Accept(this, nullptr);
+    });
+    return nullptr;
+  }
+
+  void* VisitAlternative(RegExpAlternative* node, void*) override {
+    for (RegExpTree* child : *node->nodes()) {
+      child->Accept(this, nullptr);
+    }
+    return nullptr;
+  }
+
+  void* VisitAssertion(RegExpAssertion* node, void*) override {
+    Emit(RegExpInstruction::Assertion(node->assertion_type()));
+    return nullptr;
+  }
+
+  void* VisitCharacterClass(RegExpCharacterClass* node, void*) override {
+    CompileCharacterRanges(node->ranges(zone_), node->is_negated());
+    return nullptr;
+  }
+
+  void* VisitAtom(RegExpAtom* node, void*) override {
+    for (uc16 c : node->data()) {
+      Emit(RegExpInstruction::ConsumeRange(RegExpInstruction::Uc16Range{c, c}));
+    }
+    return nullptr;
+  }
+
+  void* VisitText(RegExpText* node, void*) override {
+    for (TextElement& element : *node->elements()) {
+      element.tree()->Accept(this, nullptr);
+    }
+    return nullptr;
+  }
+
+  void* VisitQuantifier(RegExpQuantifier* node, void*) override {
+    RegExpTree* body = node->body();
+    Interval captures = body->CaptureRegisters();
+
+    // The mandatory iterations are emitted as copies of the body.
+    for (int i = 0; i < node->min() && !too_large_; ++i) {
+      ClearCaptures(captures);
+      body->Accept(this, nullptr);
+    }
+
+    if (node->max() == RegExpTree::kInfinity) {
+      if (node->is_greedy()) {
+        CompileGreedyStar(body, captures);
+      } else {
+        CompileNonGreedyStar(body, captures);
+      }
+      return nullptr;
+    }
+
+    // Each optional iteration may skip to the end, which gives up on all
+    // remaining iterations as well.
+    std::vector<int> jmps_to_end;
+    for (int i = node->min(); i < node->max() && !too_large_; ++i) {
+      if (node->is_greedy()) {
+        //   FORK end
+        //   <clear captures>
+        //   <body>
+        jmps_to_end.push_back(Emit(RegExpInstruction::Fork(-1)));
+      } else {
+        //   FORK body
+        //   JMP end
+        // body:
+        //   <clear captures>
+        //   <body>
+        int fork = Emit(RegExpInstruction::Fork(-1));
+        jmps_to_end.push_back(Emit(RegExpInstruction::Jmp(-1)));
+        Patch(fork, pc());
+      }
+      ClearCaptures(captures);
+      body->Accept(this, nullptr);
+    }
+    for (int jmp : jmps_to_end) Patch(jmp, pc());
+    return nullptr;
+  }
+
+  void* VisitCapture(RegExpCapture* node, void*) override {
+    Emit(RegExpInstruction::SetRegisterToCp(
+        RegExpCapture::StartRegister(node->index())));
+    node->body()->Accept(this, nullptr);
+    Emit(RegExpInstruction::SetRegisterToCp(
+        RegExpCapture::EndRegister(node->index())));
+    return nullptr;
+  }
+
+  void* VisitGroup(RegExpGroup* node, void*) override {
+    node->body()->Accept(this, nullptr);
+    return nullptr;
+  }
+
+  void* VisitLookaround(RegExpLookaround* node, void*) override {
+    UNREACHABLE();
+  }
+
+  void* VisitBackReference(RegExpBackReference* node, void*) override {
+    UNREACHABLE();
+  }
+
+  void* VisitEmpty(RegExpEmpty* node, void*) override { return nullptr; }
+
+  Zone* const zone_;
+  ZoneList<RegExpInstruction>* const code_;
+  bool too_large_ = false;
+};
+
+}  // namespace
+
+// static
+bool ExperimentalRegExpCompiler::CanBeHandled(RegExpTree* tree,
+                                              JSRegExp::Flags flags) {
+  return CanBeHandledVisitor::Check(tree, flags);
+}
+
+// static
+ZoneList<RegExpInstruction>* ExperimentalRegExpCompiler::Compile(
+    RegExpTree* tree, JSRegExp::Flags flags, Zone* zone) {
+  DCHECK(CanBeHandled(tree, flags));
+  return CompileVisitor::Compile(tree, zone);
+}
+
+}  // namespace internal
+}  // namespace v8
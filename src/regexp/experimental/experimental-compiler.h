@@ -0,0 +1,38 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_REGEXP_EXPERIMENTAL_EXPERIMENTAL_COMPILER_H_
+#define V8_REGEXP_EXPERIMENTAL_EXPERIMENTAL_COMPILER_H_
+
+#include "src/regexp/experimental/experimental-bytecode.h"
+#include "src/regexp/regexp-ast.h"
+#include "src/utils/utils.h"
+#include "src/zone/zone.h"
+
+namespace v8 {
+namespace internal {
+
+class ExperimentalRegExpCompiler final : public AllStatic {
+ public:
+  // Checks whether a given RegExpTree can be compiled into an experimental
+  // bytecode program. This mostly excludes features that cannot be matched
+  // in linear time, i.e. backreferences and lookarounds. Ignore-case and
+  // unicode regexps are not supported yet either.
+  static bool CanBeHandled(RegExpTree* tree, JSRegExp::Flags flags);
+
+  // Compiles a RegExpTree (for which {CanBeHandled} returned true) into
+  // bytecode. Returns nullptr if the program would exceed
+  // {kMaxInstructionCount} instructions, e.g. because of large bounded
+  // quantifiers.
+  static ZoneList<RegExpInstruction>* Compile(RegExpTree* tree,
+                                              JSRegExp::Flags flags,
+                                              Zone* zone);
+
+  static constexpr int kMaxInstructionCount = 16 * KB;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_REGEXP_EXPERIMENTAL_EXPERIMENTAL_COMPILER_H_
@@ -0,0 +1,258 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/regexp/experimental/experimental-interpreter.h"
+
+#include "src/regexp/regexp.h"
+#include "src/strings/char-predicates-inl.h"
+#include "src/utils/memcopy.h"
+#include "src/zone/zone-containers.h"
+#include "src/zone/zone.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+bool IsLineTerminator(uc16 c) {
+  return c == '\n' || c == '\r' || c == 0x2028 || c == 0x2029;
+}
+
+bool IsWordCharacter(uc16 c) { return IsAsciiIdentifier(c) && c != '$'; }
+
+// A Pike VM: all threads advance through the input in lockstep, one character
+// at a time. Threads are kept in priority order, and at each input position at
+// most one thread (the one with the highest priority) executes any given
+// instruction. This bounds the work per input character by the length of the
+// bytecode.
+template <class Character>
+class NfaInterpreter {
+ public:
+  NfaInterpreter(Vector<const RegExpInstruction> bytecode, int register_count,
+                 Vector<const Character> input, int start_index, bool sticky,
+                 Zone* zone)
+      : bytecode_(bytecode),
+        register_count_(register_count),
+        input_(input),
+        input_index_(start_index),
+        start_index_(start_index),
+        sticky_(sticky),
+        pc_last_input_index_(bytecode.length(), -1, zone),
+        active_threads_(zone),
+        blocked_threads_(zone),
+        next_threads_(zone),
+        free_register_arrays_(zone),
+        zone_(zone) {}
+
+  bool FindMatch(int32_t* output_registers) {
+    for (;;) {
+      // Threads which consumed the previous character have higher priority
+      // than a thread starting a new match attempt at this position, so the
+      // latter goes to the bottom of the stack.
+      if (best_match_registers_ == nullptr &&
+          (!sticky_ || input_index_ == start_index_)) {
+        active_threads_.push_back(Thread{0, NewRegisterArray()});
+      }
+      for (auto it = next_threads_.rbegin(); it != next_threads_.rend();
+           ++it) {
+        active_threads_.push_back(*it);
+      }
+      next_threads_.clear();
+
+      RunActiveThreads();
+      if (input_index_ == input_.length()) break;
+
+      // Advance the blocked threads over the current character.
+      uc16 c = input_[input_index_];
+      for (const Thread& thread : blocked_threads_) {
+        RegExpInstruction::Uc16Range range =
+            bytecode_[thread.pc].payload.consume_range;
+        if (range.min <= c && c <= range.max) {
+          next_threads_.push_back(Thread{thread.pc + 1, thread.registers});
+        } else {
+          DestroyThread(thread);
+        }
+      }
+      blocked_threads_.clear();
+      ++input_index_;
+
+      if (next_threads_.empty() &&
+          (best_match_registers_ != nullptr || sticky_)) {
+        break;
+      }
+    }
+
+    for (const Thread& thread : blocked_threads_) DestroyThread(thread);
+    blocked_threads_.clear();
+    if (best_match_registers_ == nullptr) return false;
+    MemCopy(output_registers, best_match_registers_,
+            register_count_ * sizeof(int32_t));
+    return true;
+  }
+
+ private:
+  struct Thread {
+    int pc;
+    int32_t* registers;
+  };
+
+  int32_t* NewRegisterArray() {
+    int32_t* registers;
+    if (free_register_arrays_.empty()) {
+      registers = zone_->NewArray<int32_t>(register_count_);
+    } else {
+      registers = free_register_arrays_.back();
+      free_register_arrays_.pop_back();
+    }
+    std::fill_n(registers, register_count_, -1);
+    return registers;
+  }
+
+  int32_t* CopyRegisterArray(const int32_t* registers) {
+    int32_t* copy = NewRegisterArray();
+    MemCopy(copy, registers, register_count_ * sizeof(int32_t));
+    return copy;
+  }
+
+  void DestroyThread(const Thread& thread) {
+    free_register_arrays_.push_back(thread.registers);
+  }
+
+  bool CheckAssertion(RegExpAssertion::AssertionType type) const {
+    int length = input_.length();
+    switch (type) {
+      case RegExpAssertion::START_OF_INPUT:
+        return input_index_ == 0;
+      case RegExpAssertion::END_OF_INPUT:
+        return input_index_ == length;
+      case RegExpAssertion::START_OF_LINE:
+        return input_index_ == 0 || IsLineTerminator(input_[input_index_ - 1]);
+      case RegExpAssertion::END_OF_LINE:
+        return input_index_ == length || IsLineTerminator(input_[input_index_]);
+      case RegExpAssertion::BOUNDARY:
+      case RegExpAssertion::NON_BOUNDARY: {
+        bool word_before =
+            input_index_ > 0 && IsWordCharacter(input_[input_index_ - 1]);
+        bool word_after =
+            input_index_ < length && IsWordCharacter(input_[input_index_]);
+        return (word_before != word_after) ==
+               (type == RegExpAssertion::BOUNDARY);
+      }
+    }
+    UNREACHABLE();
+  }
+
+  // Runs the threads on the stack of active threads, highest priority (top of
+  // the stack) first, until each of them is blocked on a CONSUME_RANGE
+  // instruction, accepts, or dies.
+  void RunActiveThreads() {
+    while (!active_threads_.empty()) {
+      Thread thread = active_threads_.back();
+      active_threads_.pop_back();
+      RunActiveThread(thread);
+    }
+  }
+
+  void RunActiveThread(Thread thread) {
+    for (;;) {
+      // A thread with higher priority already executed this instruction at
+      // the current input position, and this one cannot do any better.
+      if (pc_last_input_index_[thread.pc] == input_index_) {
+        DestroyThread(thread);
+        return;
+      }
+      pc_last_input_index_[thread.pc] = input_index_;
+
+      const RegExpInstruction& instruction = bytecode_[thread.pc];
+      switch (instruction.opcode) {
+        case RegExpInstruction::CONSUME_RANGE:
+          blocked_threads_.push_back(thread);
+          return;
+        case RegExpInstruction::ASSERTION:
+          if (!CheckAssertion(instruction.payload.assertion_type)) {
+            DestroyThread(thread);
+            return;
+          }
+          ++thread.pc;
+          break;
+        case RegExpInstruction::FORK:
+          // The forked thread has lower priority than the continuation of
+          // this thread, but higher priority than all threads on the stack.
+          active_threads_.push_back(Thread{
+              instruction.payload.pc, CopyRegisterArray(thread.registers)});
+          ++thread.pc;
+          break;
+        case RegExpInstruction::JMP:
+          thread.pc = instruction.payload.pc;
+          break;
+        case RegExpInstruction::SET_REGISTER_TO_CP:
+          thread.registers[instruction.payload.register_index] = input_index_;
+          ++thread.pc;
+          break;
+        case RegExpInstruction::CLEAR_REGISTER:
+          thread.registers[instruction.payload.register_index] = -1;
+          ++thread.pc;
+          break;
+        case RegExpInstruction::ACCEPT:
+          // All remaining active threads have lower priority and are
+          // discarded. Blocked threads have higher priority and might still
+          // produce a preferred match.
+          if (best_match_registers_ != nullptr) {
+            free_register_arrays_.push_back(best_match_registers_);
+          }
+          best_match_registers_ = thread.registers;
+          for (const Thread& other : active_threads_) DestroyThread(other);
+          active_threads_.clear();
+          return;
+      }
+    }
+  }
+
+  const Vector<const RegExpInstruction> bytecode_;
+  const int register_count_;
+  const Vector<const Character> input_;
+  int input_index_;
+  const int start_index_;
+  const bool sticky_;
+
+  // The input index at which each instruction was last executed.
+  ZoneVector<int> pc_last_input_index_;
+  // Threads still to be run at the current input position (a stack, top has
+  // the highest priority).
+  ZoneVector<Thread> active_threads_;
+  // Threads waiting at a CONSUME_RANGE instruction, in priority order.
+  ZoneVector<Thread> blocked_threads_;
+  // Threads which consumed the previous character, in priority order.
+  ZoneVector<Thread> next_threads_;
+  ZoneVector<int32_t*> free_register_arrays_;
+  int32_t* best_match_registers_ = nullptr;
+  Zone* const zone_;
+};
+
+}  // namespace
+
+// static
+int ExperimentalRegExpInterpreter::FindMatch(
+    Vector<const RegExpInstruction> bytecode, int register_count,
+    String::FlatContent input, int start_index, bool sticky,
+    int32_t* output_registers, Zone* zone) {
+  DCHECK(input.IsFlat());
+  bool found;
+  if (input.IsOneByte()) {
+    NfaInterpreter<uint8_t> interpreter(bytecode, register_count,
+                                        input.ToOneByteVector(), start_index,
+                                        sticky, zone);
+    found = interpreter.FindMatch(output_registers);
+  } else {
+    NfaInterpreter<uc16> interpreter(bytecode, register_count,
+                                     input.ToUC16Vector(), start_index, sticky,
+                                     zone);
+    found = interpreter.FindMatch(output_registers);
+  }
+  return found ? RegExp::kInternalRegExpSuccess
+               : RegExp::kInternalRegExpFailure;
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,37 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_REGEXP_EXPERIMENTAL_EXPERIMENTAL_INTERPRETER_H_
+#define V8_REGEXP_EXPERIMENTAL_EXPERIMENTAL_INTERPRETER_H_
+
+#include "src/objects/string.h"
+#include "src/regexp/experimental/experimental-bytecode.h"
+#include "src/utils/vector.h"
+
+namespace v8 {
+namespace internal {
+
+class Zone;
+
+class ExperimentalRegExpInterpreter final : public AllStatic {
+ public:
+  // Searches for the first match of {bytecode} in {input}, starting at
+  // {start_index}. A sticky search only considers matches starting at
+  // {start_index}. Like a backtracking engine, the match that starts first is
+  // chosen, and among those the one preferred by the priorities of
+  // alternatives and quantifiers.
+  // On success, the {register_count} capture registers of the match are
+  // written to {output_registers} and RegExp::kInternalRegExpSuccess is
+  // returned, otherwise RegExp::kInternalRegExpFailure.
+  // Runs in O(input length * bytecode length * register count) time.
+  static int FindMatch(Vector<const RegExpInstruction> bytecode,
+                       int register_count, String::FlatContent input,
+                       int start_index, bool sticky, int32_t* output_registers,
+                       Zone* zone);
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_REGEXP_EXPERIMENTAL_EXPERIMENTAL_INTERPRETER_H_
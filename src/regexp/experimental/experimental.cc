@@ -0,0 +1,103 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/regexp/experimental/experimental.h"
+
+#include "src/execution/isolate.h"
+#include "src/heap/factory.h"
+#include "src/objects/js-regexp-inl.h"
+#include "src/regexp/experimental/experimental-compiler.h"
+#include "src/regexp/experimental/experimental-interpreter.h"
+#include "src/regexp/regexp-compiler.h"
+#include "src/zone/zone-list-inl.h"
+
+namespace v8 {
+namespace internal {
+
+// static
+bool ExperimentalRegExp::CanBeHandled(RegExpTree* tree,
+                                      JSRegExp::Flags flags) {
+  return ExperimentalRegExpCompiler::CanBeHandled(tree, flags);
+}
+
+// static
+bool ExperimentalRegExp::Initialize(Isolate* isolate, Handle<JSRegExp> re,
+                                    Handle<String> pattern,
+                                    JSRegExp::Flags flags,
+                                    RegExpCompileData* parse_result) {
+  Zone zone(isolate->allocator(), ZONE_NAME);
+  ZoneList<RegExpInstruction>* bytecode =
+      ExperimentalRegExpCompiler::Compile(parse_result->tree, flags, &zone);
+  if (bytecode == nullptr) return false;
+
+  Handle<ByteArray> bytecode_array = isolate->factory()->NewByteArray(
+      bytecode->length() * sizeof(RegExpInstruction), AllocationType::kOld);
+  MemCopy(bytecode_array->GetDataStartAddress(), bytecode->begin(),
+          bytecode_array->length());
+
+  // The experimental engine uses the irregexp data layout. Its bytecode works
+  // for both one-byte and two-byte subjects.
+  isolate->factory()->SetRegExpIrregexpData(re, JSRegExp::EXPERIMENTAL,
+                                            pattern, flags,
+                                            parse_result->capture_count);
+  FixedArray data = FixedArray::cast(re->data());
+  data.set(JSRegExp::kIrregexpLatin1BytecodeIndex, *bytecode_array);
+  data.set(JSRegExp::kIrregexpMaxRegisterCountIndex,
+           Smi::FromInt(RegisterCount(*re)));
+  if (!parse_result->capture_name_map.is_null()) {
+    data.set(JSRegExp::kIrregexpCaptureNameMapIndex,
+             *parse_result->capture_name_map);
+  } else {
+    data.set(JSRegExp::kIrregexpCaptureNameMapIndex, Smi::kZero);
+  }
+  return true;
+}
+
+// static
+int ExperimentalRegExp::ExecRaw(Isolate* isolate, Handle<JSRegExp> regexp,
+                                Handle<String> subject, int index,
+                                int32_t* output_registers) {
+  DCHECK_EQ(JSRegExp::EXPERIMENTAL, regexp->TypeTag());
+  DCHECK(subject->IsFlat());
+  DCHECK_LE(0, index);
+  DCHECK_LE(index, subject->length());
+
+  Zone zone(isolate->allocator(), ZONE_NAME);
+  DisallowHeapAllocation no_gc;
+  ByteArray bytecode_array =
+      ByteArray::cast(regexp->DataAt(JSRegExp::kIrregexpLatin1BytecodeIndex));
+  Vector<const RegExpInstruction> bytecode(
+      reinterpret_cast<const RegExpInstruction*>(
+          bytecode_array.GetDataStartAddress()),
+      bytecode_array.length() / sizeof(RegExpInstruction));
+  return ExperimentalRegExpInterpreter::FindMatch(
+      bytecode, RegisterCount(*regexp), subject->GetFlatContent(no_gc), index,
+      IsSticky(regexp->GetFlags()), output_registers, &zone);
+}
+
+// static
+MaybeHandle<Object> ExperimentalRegExp::Exec(
+    Isolate* isolate, Handle<JSRegExp> regexp, Handle<String> subject,
+    int index, Handle<RegExpMatchInfo> last_match_info) {
+  subject = String::Flatten(isolate, subject);
+
+  int register_count = RegisterCount(*regexp);
+  int32_t* output_registers = nullptr;
+  if (register_count > Isolate::kJSRegexpStaticOffsetsVectorSize) {
+    output_registers = NewArray<int32_t>(register_count);
+  }
+  std::unique_ptr<int32_t[]> auto_release(output_registers);
+  if (output_registers == nullptr) {
+    output_registers = isolate->jsregexp_static_offsets_vector();
+  }
+
+  int result = ExecRaw(isolate, regexp, subject, index, output_registers);
+  if (result == RegExp::RE_FAILURE) return isolate->factory()->null_value();
+  DCHECK_EQ(RegExp::RE_SUCCESS, result);
+  return RegExp::SetLastMatchInfo(isolate, last_match_info, subject,
+                                  regexp->CaptureCount(), output_registers);
+}
+
+}  // namespace internal
+}  // namespace v8
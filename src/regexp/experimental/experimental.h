@@ -0,0 +1,47 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_REGEXP_EXPERIMENTAL_EXPERIMENTAL_H_
+#define V8_REGEXP_EXPERIMENTAL_EXPERIMENTAL_H_
+
+#include "src/regexp/regexp.h"
+
+namespace v8 {
+namespace internal {
+
+// An automaton-based regexp engine which matches in time linear in the length
+// of the subject (for a fixed pattern). It does not support all regexp
+// features, see {CanBeHandled}. Enabled with
+// --enable-experimental-regexp-engine.
+class ExperimentalRegExp final : public AllStatic {
+ public:
+  // Initialization & Compilation
+  // -------------------------------------------------------------------------
+  static bool CanBeHandled(RegExpTree* tree, JSRegExp::Flags flags);
+  // Compiles the parsed pattern and stores the bytecode in {re}. Returns false
+  // (and leaves {re} untouched) if the bytecode would be too large.
+  static bool Initialize(Isolate* isolate, Handle<JSRegExp> re,
+                         Handle<String> pattern, JSRegExp::Flags flags,
+                         RegExpCompileData* parse_result);
+
+  // Execution
+  // -------------------------------------------------------------------------
+  V8_WARN_UNUSED_RESULT static MaybeHandle<Object> Exec(
+      Isolate* isolate, Handle<JSRegExp> regexp, Handle<String> subject,
+      int index, Handle<RegExpMatchInfo> last_match_info);
+  // Searches for a match starting at {index} and writes its capture registers
+  // to {output_registers}, which must have room for {RegisterCount}
+  // registers. Returns RegExp::RE_SUCCESS or RegExp::RE_FAILURE.
+  static int ExecRaw(Isolate* isolate, Handle<JSRegExp> regexp,
+                     Handle<String> subject, int index,
+                     int32_t* output_registers);
+  static int RegisterCount(JSRegExp regexp) {
+    return (regexp.CaptureCount() + 1) * 2;
+  }
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_REGEXP_EXPERIMENTAL_EXPERIMENTAL_H_
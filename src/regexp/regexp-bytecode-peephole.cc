@@ -0,0 +1,286 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/regexp/regexp-bytecode-peephole.h"
+
+#include "src/execution/isolate.h"
+#include "src/heap/factory.h"
+#include "src/objects/objects-inl.h"
+#include "src/regexp/regexp-bytecodes.h"
+#include "src/utils/memcopy.h"
+#include "src/zone/zone-containers.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+// All bytecodes and their operands are 4-byte aligned, so the optimizer
+// works on words. Offsets below are word offsets unless stated otherwise.
+constexpr int kWordSize = 4;
+
+int Bytecode(int32_t insn) { return insn & BYTECODE_MASK; }
+
+// Replaces the bytecode of {insn} and keeps its packed 24-bit argument.
+int32_t WithBytecode(int32_t insn, int bytecode) {
+  return static_cast<int32_t>(
+      (static_cast<uint32_t>(insn) & ~((1u << BYTECODE_SHIFT) - 1)) |
+      static_cast<uint32_t>(bytecode));
+}
+
+// Word offsets of the operands of {bytecode} that hold absolute jump
+// targets (including backtrack addresses pushed by PUSH_BT).
+struct JumpOperands {
+  int count;
+  int offsets[2];
+};
+
+JumpOperands GetJumpOperands(int bytecode) {
+  switch (bytecode) {
+    case BC_PUSH_BT:
+    case BC_GOTO:
+    case BC_LOAD_CURRENT_CHAR:
+    case BC_LOAD_2_CURRENT_CHARS:
+    case BC_LOAD_4_CURRENT_CHARS:
+    case BC_CHECK_CHAR:
+    case BC_CHECK_NOT_CHAR:
+    case BC_CHECK_BIT_IN_TABLE:
+    case BC_CHECK_LT:
+    case BC_CHECK_GT:
+    case BC_CHECK_NOT_BACK_REF:
+    case BC_CHECK_NOT_BACK_REF_NO_CASE:
+    case BC_CHECK_NOT_BACK_REF_NO_CASE_UNICODE:
+    case BC_CHECK_NOT_BACK_REF_BACKWARD:
+    case BC_CHECK_NOT_BACK_REF_NO_CASE_BACKWARD:
+    case BC_CHECK_NOT_BACK_REF_NO_CASE_UNICODE_BACKWARD:
+    case BC_CHECK_REGISTER_EQ_POS:
+    case BC_CHECK_AT_START:
+    case BC_CHECK_NOT_AT_START:
+    case BC_CHECK_GREEDY:
+    case BC_ADVANCE_CP_AND_GOTO:
+      return {1, {1, 0}};
+    case BC_CHECK_4_CHARS:
+    case BC_CHECK_NOT_4_CHARS:
+    case BC_AND_CHECK_CHAR:
+    case BC_AND_CHECK_NOT_CHAR:
+    case BC_MINUS_AND_CHECK_NOT_CHAR:
+    case BC_CHECK_CHAR_IN_RANGE:
+    case BC_CHECK_CHAR_NOT_IN_RANGE:
+    case BC_CHECK_NOT_REGS_EQUAL:
+    case BC_CHECK_REGISTER_LT:
+    case BC_CHECK_REGISTER_GE:
+      return {1, {2, 0}};
+    case BC_AND_CHECK_4_CHARS:
+    case BC_AND_CHECK_NOT_4_CHARS:
+      return {1, {3, 0}};
+    case BC_SKIP_UNTIL_CHAR:
+      return {2, {3, 4}};
+    case BC_SKIP_UNTIL_BIT_IN_TABLE:
+      return {2, {6, 7}};
+    case BC_LOAD_AND_CHECK_CHAR:
+    case BC_LOAD_AND_CHECK_NOT_CHAR:
+      return {2, {2, 3}};
+    default:
+      return {0, {0, 0}};
+  }
+}
+
+class PeepholeOptimizer {
+ public:
+  PeepholeOptimizer(Zone* zone, const int32_t* code, int length)
+      : code_(code),
+        length_(length),
+        is_insn_start_(length + 1, false, zone),
+        is_jump_target_(length + 1, false, zone),
+        new_offsets_(length + 1, -1, zone),
+        output_(zone),
+        fixups_(zone) {}
+
+  // Returns false if the bytecode could not be decoded or if no sequence was
+  // fused.
+  bool Run() {
+    if (!Analyze()) return false;
+    bool changed = false;
+    int pc = 0;
+    while (pc < length_) {
+      new_offsets_[pc] = static_cast<int>(output_.size());
+      int consumed = TryFuse(pc);
+      if (consumed == 0) {
+        consumed = Length(pc);
+        EmitCopy(pc, consumed);
+      } else {
+        changed = true;
+      }
+      pc += consumed;
+    }
+    DCHECK_EQ(length_, pc);
+    new_offsets_[length_] = static_cast<int>(output_.size());
+    if (!changed) return false;
+
+    for (const Fixup& fixup : fixups_) {
+      int target = new_offsets_[fixup.old_target];
+      DCHECK_LE(0, target);
+      output_[fixup.position] = target * kWordSize;
+    }
+    return true;
+  }
+
+  const ZoneVector<int32_t>& output() const { return output_; }
+
+ private:
+  struct Fixup {
+    int position;    // Word offset of the operand in the output.
+    int old_target;  // Word offset of the target in the input.
+  };
+
+  int Length(int pc) const {
+    return RegExpBytecodeLength(Bytecode(code_[pc])) / kWordSize;
+  }
+
+  bool IsBytecode(int pc, int bytecode) const {
+    return pc < length_ && Bytecode(code_[pc]) == bytecode;
+  }
+
+  int JumpTarget(int pc, int operand) const {
+    return code_[pc + operand] / kWordSize;
+  }
+
+  // Finds all instruction starts and jump targets. Bails out on anything
+  // the optimizer does not understand, e.g. a jump into the middle of an
+  // instruction.
+  bool Analyze() {
+    int pc = 0;
+    while (pc < length_) {
+      int bytecode = Bytecode(code_[pc]);
+      if (bytecode >= kRegExpBytecodeCount) return false;
+      int length = RegExpBytecodeLength(bytecode) / kWordSize;
+      if (pc + length > length_) return false;
+      is_insn_start_[pc] = true;
+      JumpOperands jumps = GetJumpOperands(bytecode);
+      for (int i = 0; i < jumps.count; i++) {
+        int32_t target = code_[pc + jumps.offsets[i]];
+        if (target < 0 || target > length_ * kWordSize ||
+            target % kWordSize != 0) {
+          return false;
+        }
+        is_jump_target_[target / kWordSize] = true;
+      }
+      pc += length;
+    }
+    is_insn_start_[length_] = true;
+    for (int i = 0; i <= length_; i++) {
+      if (is_jump_target_[i] && !is_insn_start_[i]) return false;
+    }
+    return true;
+  }
+
+  // Returns the number of input words replaced by a superinstruction at
+  // {pc}, or 0 if no sequence starting at {pc} could be fused. Only the first
+  // instruction of a fused sequence may be a jump target.
+  int TryFuse(int pc) {
+    if (!IsBytecode(pc, BC_LOAD_CURRENT_CHAR)) return 0;
+    const int check = pc + BC_LOAD_CURRENT_CHAR_LENGTH / kWordSize;
+    if (check >= length_ || is_jump_target_[check]) return 0;
+    const int32_t load = code_[pc];
+
+    if (IsBytecode(check, BC_CHECK_CHAR)) {
+      const int advance = check + BC_CHECK_CHAR_LENGTH / kWordSize;
+      if (IsLoopBack(advance, pc)) {
+        // LOAD_CURRENT_CHAR; CHECK_CHAR; ADVANCE_CP_AND_GOTO back to the load.
+        Emit(WithBytecode(load, BC_SKIP_UNTIL_CHAR));
+        Emit(code_[advance] >> BYTECODE_SHIFT);
+        Emit(code_[check] >> BYTECODE_SHIFT);
+        EmitJump(JumpTarget(check, 1));
+        EmitJump(JumpTarget(pc, 1));
+        return advance + BC_ADVANCE_CP_AND_GOTO_LENGTH / kWordSize - pc;
+      }
+      Emit(WithBytecode(load, BC_LOAD_AND_CHECK_CHAR));
+      Emit(code_[check] >> BYTECODE_SHIFT);
+      EmitJump(JumpTarget(check, 1));
+      EmitJump(JumpTarget(pc, 1));
+      return advance - pc;
+    }
+
+    if (IsBytecode(check, BC_CHECK_NOT_CHAR)) {
+      Emit(WithBytecode(load, BC_LOAD_AND_CHECK_NOT_CHAR));
+      Emit(code_[check] >> BYTECODE_SHIFT);
+      EmitJump(JumpTarget(check, 1));
+      EmitJump(JumpTarget(pc, 1));
+      return check + BC_CHECK_NOT_CHAR_LENGTH / kWordSize - pc;
+    }
+
+    if (IsBytecode(check, BC_CHECK_BIT_IN_TABLE)) {
+      const int advance = check + BC_CHECK_BIT_IN_TABLE_LENGTH / kWordSize;
+      if (!IsLoopBack(advance, pc)) return 0;
+      // LOAD_CURRENT_CHAR; CHECK_BIT_IN_TABLE; ADVANCE_CP_AND_GOTO back to
+      // the load.
+      Emit(WithBytecode(load, BC_SKIP_UNTIL_BIT_IN_TABLE));
+      Emit(code_[advance] >> BYTECODE_SHIFT);
+      for (int i = 2; i < BC_CHECK_BIT_IN_TABLE_LENGTH / kWordSize; i++) {
+        Emit(code_[check + i]);
+      }
+      EmitJump(JumpTarget(check, 1));
+      EmitJump(JumpTarget(pc, 1));
+      return advance + BC_ADVANCE_CP_AND_GOTO_LENGTH / kWordSize - pc;
+    }
+    return 0;
+  }
+
+  // Whether {pc} holds an ADVANCE_CP_AND_GOTO to {loop_start} that is not
+  // itself a jump target.
+  bool IsLoopBack(int pc, int loop_start) const {
+    return IsBytecode(pc, BC_ADVANCE_CP_AND_GOTO) && !is_jump_target_[pc] &&
+           JumpTarget(pc, 1) == loop_start;
+  }
+
+  void Emit(int32_t word) { output_.push_back(word); }
+
+  void EmitJump(int old_target) {
+    fixups_.push_back({static_cast<int>(output_.size()), old_target});
+    Emit(0);
+  }
+
+  void EmitCopy(int pc, int length) {
+    JumpOperands jumps = GetJumpOperands(Bytecode(code_[pc]));
+    int next_jump = 0;
+    for (int i = 0; i < length; i++) {
+      if (next_jump < jumps.count && jumps.offsets[next_jump] == i) {
+        EmitJump(JumpTarget(pc, i));
+        next_jump++;
+      } else {
+        Emit(code_[pc + i]);
+      }
+    }
+  }
+
+  const int32_t* const code_;
+  const int length_;
+  ZoneVector<bool> is_insn_start_;
+  ZoneVector<bool> is_jump_target_;
+  // Maps word offsets of instructions in the input to the output.
+  ZoneVector<int> new_offsets_;
+  ZoneVector<int32_t> output_;
+  ZoneVector<Fixup> fixups_;
+};
+
+}  // namespace
+
+// static
+MaybeHandle<ByteArray> RegExpBytecodePeephole::OptimizeBytecode(
+    Isolate* isolate, Zone* zone, const byte* bytecode, int length) {
+  DCHECK_EQ(0, length % kWordSize);
+  DCHECK_EQ(0, reinterpret_cast<intptr_t>(bytecode) % kWordSize);
+  PeepholeOptimizer optimizer(zone, reinterpret_cast<const int32_t*>(bytecode),
+                              length / kWordSize);
+  if (!optimizer.Run()) return MaybeHandle<ByteArray>();
+
+  const ZoneVector<int32_t>& output = optimizer.output();
+  int new_length = static_cast<int>(output.size()) * kWordSize;
+  Handle<ByteArray> array = isolate->factory()->NewByteArray(new_length);
+  MemCopy(array->GetDataStartAddress(), output.data(), new_length);
+  return array;
+}
+
+}  // namespace internal
+}  // namespace v8
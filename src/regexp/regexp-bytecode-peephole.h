@@ -0,0 +1,32 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_REGEXP_REGEXP_BYTECODE_PEEPHOLE_H_
+#define V8_REGEXP_REGEXP_BYTECODE_PEEPHOLE_H_
+
+#include "src/common/globals.h"
+#include "src/handles/maybe-handles.h"
+
+namespace v8 {
+namespace internal {
+
+class ByteArray;
+class Zone;
+
+// Peephole optimization for the Irregexp bytecode. Fuses common sequences
+// emitted by RegExpMacroAssemblerIrregexp into the superinstructions at the
+// end of BYTECODE_ITERATOR and relocates all jump targets accordingly.
+class V8_EXPORT_PRIVATE RegExpBytecodePeephole : public AllStatic {
+ public:
+  // Returns the optimized bytecode, or an empty handle if nothing could be
+  // fused, in which case the caller should keep the original bytecode.
+  static MaybeHandle<ByteArray> OptimizeBytecode(Isolate* isolate, Zone* zone,
+                                                 const byte* bytecode,
+                                                 int length);
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_REGEXP_REGEXP_BYTECODE_PEEPHOLE_H_
@@ -5,16 +5,26 @@
 #ifndef V8_REGEXP_REGEXP_BYTECODES_H_
 #define V8_REGEXP_REGEXP_BYTECODES_H_
 
+#include "src/base/bits.h"
+#include "src/base/logging.h"
+
 namespace v8 {
 namespace internal {
 
-const int BYTECODE_MASK = 0xff;
 // The first argument is packed in with the byte code in one word, but so it
 // has 24 bits, but it can be positive and negative so only use 23 bits for
 // positive values.
 const unsigned int MAX_FIRST_ARG = 0x7fffffu;
 const int BYTECODE_SHIFT = 8;
 
+// The last four bytecodes are superinstructions that are only produced by
+// RegExpBytecodePeephole. Their operands are laid out as follows:
+//   SKIP_UNTIL_CHAR:          bc8 offset24 advance32 char32 addr32 addr32
+//   SKIP_UNTIL_BIT_IN_TABLE:  bc8 offset24 advance32 bits128 addr32 addr32
+//   LOAD_AND_CHECK_CHAR:      bc8 offset24 char32 addr32 addr32
+//   LOAD_AND_CHECK_NOT_CHAR:  bc8 offset24 char32 addr32 addr32
+// The first address is taken when the character check succeeds, the second
+// one when the load runs out of input.
 #define BYTECODE_ITERATOR(V)                                                   \
   V(BREAK, 0, 4)              /* bc8                                        */ \
   V(PUSH_CP, 1, 4)            /* bc8 pad24                                  */ \
@@ -67,7 +77,11 @@ const int BYTECODE_SHIFT = 8;
   V(CHECK_NOT_AT_START, 48, 8) /* bc8 offset24 addr32 */                       \
   V(CHECK_GREEDY, 49, 8) /* bc8 pad24 addr32                           */      \
   V(ADVANCE_CP_AND_GOTO, 50, 8)           /* bc8 offset24 addr32 */            \
-  V(SET_CURRENT_POSITION_FROM_END, 51, 4) /* bc8 idx24 */
+  V(SET_CURRENT_POSITION_FROM_END, 51, 4) /* bc8 idx24 */                     \
+  V(SKIP_UNTIL_CHAR, 52, 20)                                                   \
+  V(SKIP_UNTIL_BIT_IN_TABLE, 53, 32)                                           \
+  V(LOAD_AND_CHECK_CHAR, 54, 16)                                               \
+  V(LOAD_AND_CHECK_NOT_CHAR, 55, 16)
 
 #define DECLARE_BYTECODES(name, code, length) static const int BC_##name = code;
 BYTECODE_ITERATOR(DECLARE_BYTECODES)
@@ -78,6 +92,30 @@ BYTECODE_ITERATOR(DECLARE_BYTECODES)
 BYTECODE_ITERATOR(DECLARE_BYTECODE_LENGTH)
 #undef DECLARE_BYTECODE_LENGTH
 
+#define COUNT_BYTECODE(name, code, length) +1
+static constexpr int kRegExpBytecodeCount = BYTECODE_ITERATOR(COUNT_BYTECODE);
+#undef COUNT_BYTECODE
+
+// The interpreter dispatches through a table of this size, so every value of
+// (instruction & BYTECODE_MASK) must have an entry.
+static constexpr int kRegExpPaddedBytecodeCount = 64;
+static_assert(kRegExpBytecodeCount <= kRegExpPaddedBytecodeCount,
+              "bytecodes must fit into the padded dispatch table");
+static_assert(base::bits::IsPowerOfTwo(kRegExpPaddedBytecodeCount),
+              "BYTECODE_MASK must select a valid dispatch table index");
+const int BYTECODE_MASK = kRegExpPaddedBytecodeCount - 1;
+
+inline int RegExpBytecodeLength(int bytecode) {
+  switch (bytecode) {
+#define BYTECODE_LENGTH_CASE(name, code, length) \
+  case BC_##name:                                \
+    return length;
+    BYTECODE_ITERATOR(BYTECODE_LENGTH_CASE)
+#undef BYTECODE_LENGTH_CASE
+  }
+  UNREACHABLE();
+}
+
 }  // namespace internal
 }  // namespace v8
 
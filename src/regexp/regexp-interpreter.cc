@@ -84,14 +84,47 @@ static void TraceInterpreter(const byte* code_base, const byte* pc,
   }
 }
 
-#define BYTECODE(name)                                             \
-  case BC_##name:                                                  \
-    TraceInterpreter(code_base, pc, backtrack_stack.sp(), current, \
-                     current_char, BC_##name##_LENGTH, #name);
+#define TRACE_BYTECODE(name)                                     \
+  TraceInterpreter(code_base, pc, backtrack_stack.sp(), current, \
+                   current_char, BC_##name##_LENGTH, #name);
 #else
-#define BYTECODE(name) case BC_##name:
+#define TRACE_BYTECODE(name)
 #endif
 
+// Dispatch through a table of label addresses where the compiler supports it.
+// Each handler then ends in its own indirect jump, which the branch predictor
+// handles much better than the single shared jump of a switch.
+#if V8_HAS_COMPUTED_GOTO
+#define V8_USE_COMPUTED_GOTO 1
+#endif  // V8_HAS_COMPUTED_GOTO
+
+#if V8_USE_COMPUTED_GOTO
+#define BYTECODE(name) \
+  BC_##name:           \
+  TRACE_BYTECODE(name)
+#define DISPATCH()                              \
+  do {                                          \
+    insn = Load32Aligned(pc);                   \
+    goto* dispatch_table[insn & BYTECODE_MASK]; \
+  } while (false)
+#else
+#define BYTECODE(name) \
+  case BC_##name:      \
+    TRACE_BYTECODE(name)
+#define DISPATCH() break
+#endif  // V8_USE_COMPUTED_GOTO
+
+// Fills the unused entries of the dispatch table.
+#define BYTECODE_FILLER_ITERATOR(V) \
+  V(BREAK) /* 1 */                  \
+  V(BREAK) /* 2 */                  \
+  V(BREAK) /* 3 */                  \
+  V(BREAK) /* 4 */                  \
+  V(BREAK) /* 5 */                  \
+  V(BREAK) /* 6 */                  \
+  V(BREAK) /* 7 */                  \
+  V(BREAK) /* 8 */
+
 static int32_t Load32Aligned(const byte* pc) {
   DCHECK_EQ(0, reinterpret_cast<intptr_t>(pc) & 3);
   return *reinterpret_cast<const int32_t*>(pc);
@@ -224,59 +257,77 @@ IrregexpInterpreter::Result RawMatch(Isolate* isolate,
     PrintF("\n\nStart bytecode interpreter\n\n");
   }
 #endif
+#if V8_USE_COMPUTED_GOTO
+  // All entries from kRegExpBytecodeCount to kRegExpPaddedBytecodeCount are
+  // filled with BREAK. Together with masking the dispatch index with
+  // BYTECODE_MASK this guarantees that every jump goes to a valid handler.
+  static const void* const dispatch_table[] = {
+#define DECLARE_DISPATCH_TABLE_ENTRY(name, code, length) &&BC_##name,
+      BYTECODE_ITERATOR(DECLARE_DISPATCH_TABLE_ENTRY)
+#undef DECLARE_DISPATCH_TABLE_ENTRY
+#define DECLARE_DISPATCH_TABLE_FILLER(name) &&BC_##name,
+          BYTECODE_FILLER_ITERATOR(DECLARE_DISPATCH_TABLE_FILLER)
+#undef DECLARE_DISPATCH_TABLE_FILLER
+  };
+  STATIC_ASSERT(arraysize(dispatch_table) == kRegExpPaddedBytecodeCount);
+
+  int32_t insn;
+  DISPATCH();
+#else
   while (true) {
     const int32_t insn = Load32Aligned(pc);
     switch (insn & BYTECODE_MASK) {
+#endif  // V8_USE_COMPUTED_GOTO
       BYTECODE(BREAK) { UNREACHABLE(); }
       BYTECODE(PUSH_CP) {
         backtrack_stack.push(current);
         pc += BC_PUSH_CP_LENGTH;
-        break;
+        DISPATCH();
       }
       BYTECODE(PUSH_BT) {
         backtrack_stack.push(Load32Aligned(pc + 4));
         pc += BC_PUSH_BT_LENGTH;
-        break;
+        DISPATCH();
       }
       BYTECODE(PUSH_REGISTER) {
         backtrack_stack.push(registers[insn >> BYTECODE_SHIFT]);
         pc += BC_PUSH_REGISTER_LENGTH;
-        break;
+        DISPATCH();
       }
       BYTECODE(SET_REGISTER) {
         registers[insn >> BYTECODE_SHIFT] = Load32Aligned(pc + 4);
         pc += BC_SET_REGISTER_LENGTH;
-        break;
+        DISPATCH();
       }
       BYTECODE(ADVANCE_REGISTER) {
         registers[insn >> BYTECODE_SHIFT] += Load32Aligned(pc + 4);
         pc += BC_ADVANCE_REGISTER_LENGTH;
-        break;
+        DISPATCH();
       }
       BYTECODE(SET_REGISTER_TO_CP) {
         registers[insn >> BYTECODE_SHIFT] = current + Load32Aligned(pc + 4);
         pc += BC_SET_REGISTER_TO_CP_LENGTH;
-        break;
+        DISPATCH();
       }
       BYTECODE(SET_CP_TO_REGISTER) {
         current = registers[insn >> BYTECODE_SHIFT];
         pc += BC_SET_CP_TO_REGISTER_LENGTH;
-        break;
+        DISPATCH();
       }
       BYTECODE(SET_REGISTER_TO_SP) {
         registers[insn >> BYTECODE_SHIFT] = backtrack_stack.sp();
         pc += BC_SET_REGISTER_TO_SP_LENGTH;
-        break;
+        DISPATCH();
       }
       BYTECODE(SET_SP_TO_REGISTER) {
         backtrack_stack.set_sp(registers[insn >> BYTECODE_SHIFT]);
         pc += BC_SET_SP_TO_REGISTER_LENGTH;
-        break;
+        DISPATCH();
       }
       BYTECODE(POP_CP) {
         current = backtrack_stack.pop();
         pc += BC_POP_CP_LENGTH;
-        break;
+        DISPATCH();
       }
       BYTECODE(POP_BT) {
         IrregexpInterpreter::Result return_code =
@@ -287,28 +338,28 @@ IrregexpInterpreter::Result RawMatch(Isolate* isolate,
                                        &code_base, &pc, &subject);
 
         pc = code_base + backtrack_stack.pop();
-        break;
+        DISPATCH();
       }
       BYTECODE(POP_REGISTER) {
         registers[insn >> BYTECODE_SHIFT] = backtrack_stack.pop();
         pc += BC_POP_REGISTER_LENGTH;
-        break;
+        DISPATCH();
       }
       BYTECODE(FAIL) { return IrregexpInterpreter::FAILURE; }
       BYTECODE(SUCCEED) { return IrregexpInterpreter::SUCCESS; }
       BYTECODE(ADVANCE_CP) {
         current += insn >> BYTECODE_SHIFT;
         pc += BC_ADVANCE_CP_LENGTH;
-        break;
+        DISPATCH();
       }
       BYTECODE(GOTO) {
         pc = code_base + Load32Aligned(pc + 4);
-        break;
+        DISPATCH();
       }
       BYTECODE(ADVANCE_CP_AND_GOTO) {
         current += insn >> BYTECODE_SHIFT;
         pc = code_base + Load32Aligned(pc + 4);
-        break;
+        DISPATCH();
       }
       BYTECODE(CHECK_GREEDY) {
         if (current == backtrack_stack.peek()) {
@@ -317,7 +368,7 @@ IrregexpInterpreter::Result RawMatch(Isolate* isolate,
         } else {
           pc += BC_CHECK_GREEDY_LENGTH;
         }
-        break;
+        DISPATCH();
       }
       BYTECODE(LOAD_CURRENT_CHAR) {
         int pos = current + (insn >> BYTECODE_SHIFT);
@@ -327,13 +378,13 @@ IrregexpInterpreter::Result RawMatch(Isolate* isolate,
           current_char = subject[pos];
           pc += BC_LOAD_CURRENT_CHAR_LENGTH;
         }
-        break;
+        DISPATCH();
       }
       BYTECODE(LOAD_CURRENT_CHAR_UNCHECKED) {
         int pos = current + (insn >> BYTECODE_SHIFT);
         current_char = subject[pos];
         pc += BC_LOAD_CURRENT_CHAR_UNCHECKED_LENGTH;
-        break;
+        DISPATCH();
       }
       BYTECODE(LOAD_2_CURRENT_CHARS) {
         int pos = current + (insn >> BYTECODE_SHIFT);
@@ -345,14 +396,14 @@ IrregexpInterpreter::Result RawMatch(Isolate* isolate,
               (subject[pos] | (next << (kBitsPerByte * sizeof(Char))));
           pc += BC_LOAD_2_CURRENT_CHARS_LENGTH;
         }
-        break;
+        DISPATCH();
       }
       BYTECODE(LOAD_2_CURRENT_CHARS_UNCHECKED) {
         int pos = current + (insn >> BYTECODE_SHIFT);
         Char next = subject[pos + 1];
         current_char = (subject[pos] | (next << (kBitsPerByte * sizeof(Char))));
         pc += BC_LOAD_2_CURRENT_CHARS_UNCHECKED_LENGTH;
-        break;
+        DISPATCH();
       }
       BYTECODE(LOAD_4_CURRENT_CHARS) {
         DCHECK_EQ(1, sizeof(Char));
@@ -367,7 +418,7 @@ IrregexpInterpreter::Result RawMatch(Isolate* isolate,
               (subject[pos] | (next1 << 8) | (next2 << 16) | (next3 << 24));
           pc += BC_LOAD_4_CURRENT_CHARS_LENGTH;
         }
-        break;
+        DISPATCH();
       }
       BYTECODE(LOAD_4_CURRENT_CHARS_UNCHECKED) {
         DCHECK_EQ(1, sizeof(Char));
@@ -378,7 +429,7 @@ IrregexpInterpreter::Result RawMatch(Isolate* isolate,
         current_char =
             (subject[pos] | (next1 << 8) | (next2 << 16) | (next3 << 24));
         pc += BC_LOAD_4_CURRENT_CHARS_UNCHECKED_LENGTH;
-        break;
+        DISPATCH();
       }
       BYTECODE(CHECK_4_CHARS) {
         uint32_t c = Load32Aligned(pc + 4);
@@ -387,7 +438,7 @@ IrregexpInterpreter::Result RawMatch(Isolate* isolate,
         } else {
           pc += BC_CHECK_4_CHARS_LENGTH;
         }
-        break;
+        DISPATCH();
       }
       BYTECODE(CHECK_CHAR) {
         uint32_t c = (insn >> BYTECODE_SHIFT);
@@ -396,7 +447,7 @@ IrregexpInterpreter::Result RawMatch(Isolate* isolate,
         } else {
           pc += BC_CHECK_CHAR_LENGTH;
         }
-        break;
+        DISPATCH();
       }
       BYTECODE(CHECK_NOT_4_CHARS) {
         uint32_t c = Load32Aligned(pc + 4);
@@ -405,7 +456,7 @@ IrregexpInterpreter::Result RawMatch(Isolate* isolate,
         } else {
           pc += BC_CHECK_NOT_4_CHARS_LENGTH;
         }
-        break;
+        DISPATCH();
       }
       BYTECODE(CHECK_NOT_CHAR) {
         uint32_t c = (insn >> BYTECODE_SHIFT);
@@ -414,7 +465,7 @@ IrregexpInterpreter::Result RawMatch(Isolate* isolate,
         } else {
           pc += BC_CHECK_NOT_CHAR_LENGTH;
         }
-        break;
+        DISPATCH();
       }
       BYTECODE(AND_CHECK_4_CHARS) {
         uint32_t c = Load32Aligned(pc + 4);
@@ -423,7 +474,7 @@ IrregexpInterpreter::Result RawMatch(Isolate* isolate,
         } else {
           pc += BC_AND_CHECK_4_CHARS_LENGTH;
         }
-        break;
+        DISPATCH();
       }
       BYTECODE(AND_CHECK_CHAR) {
         uint32_t c = (insn >> BYTECODE_SHIFT);
@@ -432,7 +483,7 @@ IrregexpInterpreter::Result RawMatch(Isolate* isolate,
         } else {
           pc += BC_AND_CHECK_CHAR_LENGTH;
         }
-        break;
+        DISPATCH();
       }
       BYTECODE(AND_CHECK_NOT_4_CHARS) {
         uint32_t c = Load32Aligned(pc + 4);
@@ -441,7 +492,7 @@ IrregexpInterpreter::Result RawMatch(Isolate* isolate,
         } else {
           pc += BC_AND_CHECK_NOT_4_CHARS_LENGTH;
         }
-        break;
+        DISPATCH();
       }
       BYTECODE(AND_CHECK_NOT_CHAR) {
         uint32_t c = (insn >> BYTECODE_SHIFT);
@@ -450,7 +501,7 @@ IrregexpInterpreter::Result RawMatch(Isolate* isolate,
         } else {
           pc += BC_AND_CHECK_NOT_CHAR_LENGTH;
         }
-        break;
+        DISPATCH();
       }
       BYTECODE(MINUS_AND_CHECK_NOT_CHAR) {
         uint32_t c = (insn >> BYTECODE_SHIFT);
@@ -461,7 +512,7 @@ IrregexpInterpreter::Result RawMatch(Isolate* isolate,
         } else {
           pc += BC_MINUS_AND_CHECK_NOT_CHAR_LENGTH;
         }
-        break;
+        DISPATCH();
       }
       BYTECODE(CHECK_CHAR_IN_RANGE) {
         uint32_t from = Load16Aligned(pc + 4);
@@ -471,7 +522,7 @@ IrregexpInterpreter::Result RawMatch(Isolate* isolate,
         } else {
           pc += BC_CHECK_CHAR_IN_RANGE_LENGTH;
         }
-        break;
+        DISPATCH();
       }
       BYTECODE(CHECK_CHAR_NOT_IN_RANGE) {
         uint32_t from = Load16Aligned(pc + 4);
@@ -481,7 +532,7 @@ IrregexpInterpreter::Result RawMatch(Isolate* isolate,
         } else {
           pc += BC_CHECK_CHAR_NOT_IN_RANGE_LENGTH;
         }
-        break;
+        DISPATCH();
       }
       BYTECODE(CHECK_BIT_IN_TABLE) {
         int mask = RegExpMacroAssembler::kTableMask;
@@ -492,7 +543,7 @@ IrregexpInterpreter::Result RawMatch(Isolate* isolate,
         } else {
           pc += BC_CHECK_BIT_IN_TABLE_LENGTH;
         }
-        break;
+        DISPATCH();
       }
       BYTECODE(CHECK_LT) {
         uint32_t limit = (insn >> BYTECODE_SHIFT);
@@ -501,7 +552,7 @@ IrregexpInterpreter::Result RawMatch(Isolate* isolate,
         } else {
           pc += BC_CHECK_LT_LENGTH;
         }
-        break;
+        DISPATCH();
       }
       BYTECODE(CHECK_GT) {
         uint32_t limit = (insn >> BYTECODE_SHIFT);
@@ -510,7 +561,7 @@ IrregexpInterpreter::Result RawMatch(Isolate* isolate,
         } else {
           pc += BC_CHECK_GT_LENGTH;
         }
-        break;
+        DISPATCH();
       }
       BYTECODE(CHECK_REGISTER_LT) {
         if (registers[insn >> BYTECODE_SHIFT] < Load32Aligned(pc + 4)) {
@@ -518,7 +569,7 @@ IrregexpInterpreter::Result RawMatch(Isolate* isolate,
         } else {
           pc += BC_CHECK_REGISTER_LT_LENGTH;
         }
-        break;
+        DISPATCH();
       }
       BYTECODE(CHECK_REGISTER_GE) {
         if (registers[insn >> BYTECODE_SHIFT] >= Load32Aligned(pc + 4)) {
@@ -526,7 +577,7 @@ IrregexpInterpreter::Result RawMatch(Isolate* isolate,
         } else {
           pc += BC_CHECK_REGISTER_GE_LENGTH;
         }
-        break;
+        DISPATCH();
       }
       BYTECODE(CHECK_REGISTER_EQ_POS) {
         if (registers[insn >> BYTECODE_SHIFT] == current) {
@@ -534,7 +585,7 @@ IrregexpInterpreter::Result RawMatch(Isolate* isolate,
         } else {
           pc += BC_CHECK_REGISTER_EQ_POS_LENGTH;
         }
-        break;
+        DISPATCH();
       }
       BYTECODE(CHECK_NOT_REGS_EQUAL) {
         if (registers[insn >> BYTECODE_SHIFT] ==
@@ -543,7 +594,7 @@ IrregexpInterpreter::Result RawMatch(Isolate* isolate,
         } else {
           pc = code_base + Load32Aligned(pc + 8);
         }
-        break;
+        DISPATCH();
       }
       BYTECODE(CHECK_NOT_BACK_REF) {
         int from = registers[insn >> BYTECODE_SHIFT];
@@ -552,12 +603,12 @@ IrregexpInterpreter::Result RawMatch(Isolate* isolate,
           if (current + len > subject.length() ||
               CompareChars(&subject[from], &subject[current], len) != 0) {
             pc = code_base + Load32Aligned(pc + 4);
-            break;
+            DISPATCH();
           }
           current += len;
         }
         pc += BC_CHECK_NOT_BACK_REF_LENGTH;
-        break;
+        DISPATCH();
       }
       BYTECODE(CHECK_NOT_BACK_REF_BACKWARD) {
         int from = registers[insn >> BYTECODE_SHIFT];
@@ -566,50 +617,72 @@ IrregexpInterpreter::Result RawMatch(Isolate* isolate,
           if (current - len < 0 ||
               CompareChars(&subject[from], &subject[current - len], len) != 0) {
             pc = code_base + Load32Aligned(pc + 4);
-            break;
+            DISPATCH();
           }
           current -= len;
         }
         pc += BC_CHECK_NOT_BACK_REF_BACKWARD_LENGTH;
-        break;
+        DISPATCH();
+      }
+      BYTECODE(CHECK_NOT_BACK_REF_NO_CASE_UNICODE) {
+        int from = registers[insn >> BYTECODE_SHIFT];
+        int len = registers[(insn >> BYTECODE_SHIFT) + 1] - from;
+        if (from >= 0 && len > 0) {
+          if (current + len > subject.length() ||
+              !BackRefMatchesNoCase(isolate, from, current, len, subject,
+                                    true)) {
+            pc = code_base + Load32Aligned(pc + 4);
+            DISPATCH();
+          }
+          current += len;
+        }
+        pc += BC_CHECK_NOT_BACK_REF_NO_CASE_UNICODE_LENGTH;
+        DISPATCH();
       }
-      BYTECODE(CHECK_NOT_BACK_REF_NO_CASE_UNICODE)
-      V8_FALLTHROUGH;
       BYTECODE(CHECK_NOT_BACK_REF_NO_CASE) {
-        bool unicode =
-            (insn & BYTECODE_MASK) == BC_CHECK_NOT_BACK_REF_NO_CASE_UNICODE;
         int from = registers[insn >> BYTECODE_SHIFT];
         int len = registers[(insn >> BYTECODE_SHIFT) + 1] - from;
         if (from >= 0 && len > 0) {
           if (current + len > subject.length() ||
               !BackRefMatchesNoCase(isolate, from, current, len, subject,
-                                    unicode)) {
+                                    false)) {
             pc = code_base + Load32Aligned(pc + 4);
-            break;
+            DISPATCH();
           }
           current += len;
         }
         pc += BC_CHECK_NOT_BACK_REF_NO_CASE_LENGTH;
-        break;
+        DISPATCH();
+      }
+      BYTECODE(CHECK_NOT_BACK_REF_NO_CASE_UNICODE_BACKWARD) {
+        int from = registers[insn >> BYTECODE_SHIFT];
+        int len = registers[(insn >> BYTECODE_SHIFT) + 1] - from;
+        if (from >= 0 && len > 0) {
+          if (current - len < 0 ||
+              !BackRefMatchesNoCase(isolate, from, current - len, len, subject,
+                                    true)) {
+            pc = code_base + Load32Aligned(pc + 4);
+            DISPATCH();
+          }
+          current -= len;
+        }
+        pc += BC_CHECK_NOT_BACK_REF_NO_CASE_UNICODE_BACKWARD_LENGTH;
+        DISPATCH();
       }
-      BYTECODE(CHECK_NOT_BACK_REF_NO_CASE_UNICODE_BACKWARD)
-      V8_FALLTHROUGH;
       BYTECODE(CHECK_NOT_BACK_REF_NO_CASE_BACKWARD) {
-        bool unicode = (insn & BYTECODE_MASK) ==
-                       BC_CHECK_NOT_BACK_REF_NO_CASE_UNICODE_BACKWARD;
         int from = registers[insn >> BYTECODE_SHIFT];
         int len = registers[(insn >> BYTECODE_SHIFT) + 1] - from;
         if (from >= 0 && len > 0) {
           if (current - len < 0 ||
               !BackRefMatchesNoCase(isolate, from, current - len, len, subject,
-                                    unicode)) {
+                                    false)) {
             pc = code_base + Load32Aligned(pc + 4);
-            break;
+            DISPATCH();
           }
           current -= len;
         }
         pc += BC_CHECK_NOT_BACK_REF_NO_CASE_BACKWARD_LENGTH;
-        break;
+        DISPATCH();
       }
       BYTECODE(CHECK_AT_START) {
         if (current == 0) {
@@ -617,7 +690,7 @@ IrregexpInterpreter::Result RawMatch(Isolate* isolate,
         } else {
           pc += BC_CHECK_AT_START_LENGTH;
         }
-        break;
+        DISPATCH();
       }
       BYTECODE(CHECK_NOT_AT_START) {
         if (current + (insn >> BYTECODE_SHIFT) == 0) {
@@ -625,7 +698,7 @@ IrregexpInterpreter::Result RawMatch(Isolate* isolate,
         } else {
           pc = code_base + Load32Aligned(pc + 4);
         }
-        break;
+        DISPATCH();
       }
       BYTECODE(SET_CURRENT_POSITION_FROM_END) {
         int by = static_cast<uint32_t>(insn) >> BYTECODE_SHIFT;
@@ -634,16 +707,92 @@ IrregexpInterpreter::Result RawMatch(Isolate* isolate,
           current_char = subject[current - 1];
         }
         pc += BC_SET_CURRENT_POSITION_FROM_END_LENGTH;
-        break;
+        DISPATCH();
+      }
+      BYTECODE(SKIP_UNTIL_CHAR) {
+        int load_offset = (insn >> BYTECODE_SHIFT);
+        int32_t advance = Load32Aligned(pc + 4);
+        uint32_t c = Load32Aligned(pc + 8);
+        while (true) {
+          int pos = current + load_offset;
+          if (pos >= subject.length() || pos < 0) {
+            pc = code_base + Load32Aligned(pc + 16);
+            break;
+          }
+          current_char = subject[pos];
+          if (c == current_char) {
+            pc = code_base + Load32Aligned(pc + 12);
+            break;
+          }
+          current += advance;
+        }
+        DISPATCH();
       }
+      BYTECODE(SKIP_UNTIL_BIT_IN_TABLE) {
+        int load_offset = (insn >> BYTECODE_SHIFT);
+        int32_t advance = Load32Aligned(pc + 4);
+        const byte* table = pc + 8;
+        int mask = RegExpMacroAssembler::kTableMask;
+        while (true) {
+          int pos = current + load_offset;
+          if (pos >= subject.length() || pos < 0) {
+            pc = code_base + Load32Aligned(pc + 28);
+            break;
+          }
+          current_char = subject[pos];
+          byte b = table[(current_char & mask) >> kBitsPerByteLog2];
+          int bit = (current_char & (kBitsPerByte - 1));
+          if ((b & (1 << bit)) != 0) {
+            pc = code_base + Load32Aligned(pc + 24);
+            break;
+          }
+          current += advance;
+        }
+        DISPATCH();
+      }
+      BYTECODE(LOAD_AND_CHECK_CHAR) {
+        int pos = current + (insn >> BYTECODE_SHIFT);
+        if (pos >= subject.length() || pos < 0) {
+          pc = code_base + Load32Aligned(pc + 12);
+          DISPATCH();
+        }
+        current_char = subject[pos];
+        if (static_cast<uint32_t>(Load32Aligned(pc + 4)) == current_char) {
+          pc = code_base + Load32Aligned(pc + 8);
+        } else {
+          pc += BC_LOAD_AND_CHECK_CHAR_LENGTH;
+        }
+        DISPATCH();
+      }
+      BYTECODE(LOAD_AND_CHECK_NOT_CHAR) {
+        int pos = current + (insn >> BYTECODE_SHIFT);
+        if (pos >= subject.length() || pos < 0) {
+          pc = code_base + Load32Aligned(pc + 12);
+          DISPATCH();
+        }
+        current_char = subject[pos];
+        if (static_cast<uint32_t>(Load32Aligned(pc + 4)) != current_char) {
+          pc = code_base + Load32Aligned(pc + 8);
+        } else {
+          pc += BC_LOAD_AND_CHECK_NOT_CHAR_LENGTH;
+        }
+        DISPATCH();
+      }
+#if V8_USE_COMPUTED_GOTO
+  UNREACHABLE();
+#else
       default:
         UNREACHABLE();
         break;
     }
   }
+#endif  // V8_USE_COMPUTED_GOTO
 }
 
 #undef BYTECODE
+#undef DISPATCH
+#undef TRACE_BYTECODE
+#undef BYTECODE_FILLER_ITERATOR
 
 }  // namespace
 
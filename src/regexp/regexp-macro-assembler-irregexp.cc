@@ -6,6 +6,7 @@
 
 #include "src/ast/ast.h"
 #include "src/objects/objects-inl.h"
+#include "src/regexp/regexp-bytecode-peephole.h"
 #include "src/regexp/regexp-bytecodes.h"
 #include "src/regexp/regexp-macro-assembler-irregexp-inl.h"
 #include "src/regexp/regexp-macro-assembler.h"
@@ -425,7 +426,14 @@ Handle<HeapObject> RegExpMacroAssemblerIrregexp::GetCode(
     Handle<String> source) {
   Bind(&backtrack_);
   Emit(BC_POP_BT, 0);
-  Handle<ByteArray> array = isolate_->factory()->NewByteArray(length());
+  Handle<ByteArray> array;
+  if (FLAG_regexp_peephole_optimization &&
+      RegExpBytecodePeephole::OptimizeBytecode(isolate_, zone(),
+                                               buffer_.begin(), length())
+          .ToHandle(&array)) {
+    return array;
+  }
+  array = isolate_->factory()->NewByteArray(length());
   Copy(array->GetDataStartAddress());
   return array;
 }
@@ -7,6 +7,7 @@
 #include "src/codegen/compilation-cache.h"
 #include "src/heap/heap-inl.h"
 #include "src/objects/js-regexp-inl.h"
+#include "src/regexp/experimental/experimental.h"
 #include "src/regexp/regexp-compiler.h"
 #include "src/regexp/regexp-dotprinter.h"
 #include "src/regexp/regexp-interpreter.h"
@@ -32,6 +33,16 @@ class RegExpImpl final : public AllStatic {
                                  Handle<String> pattern, JSRegExp::Flags flags,
                                  int capture_register_count);
 
+  // Records the literal that every match of {tree} starts with, if any.
+  static void IrregexpSetLiteralPrefix(Isolate* isolate, Handle<JSRegExp> re,
+                                       RegExpTree* tree);
+
+  // Returns the first position at or after {index} where the literal prefix
+  // of {regexp} occurs in {subject}, {index} itself if the regexp has no
+  // literal prefix, or -1 if no match is possible.
+  static int IrregexpSkipToLiteralPrefix(Isolate* isolate, JSRegExp regexp,
+                                         String subject, int index);
+
   static void AtomCompile(Isolate* isolate, Handle<JSRegExp> re,
                           Handle<String> pattern, JSRegExp::Flags flags,
                           Handle<String> match_pattern);
@@ -72,7 +83,8 @@ class RegExpImpl final : public AllStatic {
   // Returns true on success, false on failure.
   static bool Compile(Isolate* isolate, Zone* zone, RegExpCompileData* input,
                       JSRegExp::Flags flags, Handle<String> pattern,
-                      Handle<String> sample_subject, bool is_one_byte);
+                      Handle<String> sample_subject, bool is_one_byte,
+                      bool use_bytecode);
 
   // For acting on the JSRegExp data FixedArray.
   static int IrregexpMaxRegisterCount(FixedArray re);
@@ -171,9 +183,17 @@ MaybeHandle<Object> RegExp::Compile(Isolate* isolate, Handle<JSRegExp> re,
       has_been_compiled = true;
     }
   }
+  if (!has_been_compiled && FLAG_enable_experimental_regexp_engine &&
+      ExperimentalRegExp::CanBeHandled(parse_result.tree, flags)) {
+    has_been_compiled = ExperimentalRegExp::Initialize(isolate, re, pattern,
+                                                       flags, &parse_result);
+  }
   if (!has_been_compiled) {
     RegExpImpl::IrregexpInitialize(isolate, re, pattern, flags,
                                    parse_result.capture_count);
+    if (FLAG_regexp_prefix_scan && !IsSticky(flags)) {
+      RegExpImpl::IrregexpSetLiteralPrefix(isolate, re, parse_result.tree);
+    }
   }
   DCHECK(re->data().IsFixedArray());
   // Compilation succeeded so the data is set on the regexp
@@ -196,6 +216,9 @@ MaybeHandle<Object> RegExp::Exec(Isolate* isolate, Handle<JSRegExp> regexp,
       return RegExpImpl::IrregexpExec(isolate, regexp, subject, index,
                                       last_match_info);
     }
+    case JSRegExp::EXPERIMENTAL:
+      return ExperimentalRegExp::Exec(isolate, regexp, subject, index,
+                                      last_match_info);
     default:
       UNREACHABLE();
   }
@@ -298,10 +321,12 @@ Handle<Object> RegExpImpl::AtomExec(Isolate* isolate, Handle<JSRegExp> re,
 bool RegExpImpl::EnsureCompiledIrregexp(Isolate* isolate, Handle<JSRegExp> re,
                                         Handle<String> sample_subject,
                                         bool is_one_byte) {
-  Object compiled_code = re->DataAt(JSRegExp::code_index(is_one_byte));
+  bool use_bytecode = re->ShouldProduceBytecode();
+  int index = use_bytecode ? JSRegExp::bytecode_index(is_one_byte)
+                           : JSRegExp::code_index(is_one_byte);
+  Object compiled_code = re->DataAt(index);
   if (compiled_code != Smi::FromInt(JSRegExp::kUninitializedValue)) {
-    DCHECK(FLAG_regexp_interpret_all ? compiled_code.IsByteArray()
-                                     : compiled_code.IsCode());
+    DCHECK(use_bytecode ? compiled_code.IsByteArray() : compiled_code.IsCode());
     return true;
   }
   return CompileIrregexp(isolate, re, sample_subject, is_one_byte);
@@ -313,8 +338,11 @@ bool RegExpImpl::CompileIrregexp(Isolate* isolate, Handle<JSRegExp> re,
   // Compile the RegExp.
   Zone zone(isolate->allocator(), ZONE_NAME);
   PostponeInterruptsScope postpone(isolate);
+  bool use_bytecode = re->ShouldProduceBytecode();
+  int index = use_bytecode ? JSRegExp::bytecode_index(is_one_byte)
+                           : JSRegExp::code_index(is_one_byte);
 #ifdef DEBUG
-  Object entry = re->DataAt(JSRegExp::code_index(is_one_byte));
+  Object entry = re->DataAt(index);
   // When arriving here entry can only be a smi representing an uncompiled
   // regexp.
   DCHECK(entry.IsSmi());
@@ -337,7 +365,7 @@ bool RegExpImpl::CompileIrregexp(Isolate* isolate, Handle<JSRegExp> re,
   }
   const bool compilation_succeeded =
       Compile(isolate, &zone, &compile_data, flags, pattern, sample_subject,
-              is_one_byte);
+              is_one_byte, use_bytecode);
   if (!compilation_succeeded) {
     DCHECK(!compile_data.error.is_null());
     ThrowRegExpException(isolate, re, compile_data.error);
@@ -346,7 +374,7 @@ bool RegExpImpl::CompileIrregexp(Isolate* isolate, Handle<JSRegExp> re,
 
   Handle<FixedArray> data =
       Handle<FixedArray>(FixedArray::cast(re->data()), isolate);
-  data->set(JSRegExp::code_index(is_one_byte), compile_data.code);
+  data->set(index, compile_data.code);
   SetIrregexpCaptureNameMap(*data, compile_data.capture_name_map);
   int register_max = IrregexpMaxRegisterCount(*data);
   if (compile_data.register_count > register_max) {
@@ -382,7 +410,7 @@ int RegExpImpl::IrregexpNumberOfRegisters(FixedArray re) {
 }
 
 ByteArray RegExpImpl::IrregexpByteCode(FixedArray re, bool is_one_byte) {
-  return ByteArray::cast(re.get(JSRegExp::code_index(is_one_byte)));
+  return ByteArray::cast(re.get(JSRegExp::bytecode_index(is_one_byte)));
 }
 
 Code RegExpImpl::IrregexpNativeCode(FixedArray re, bool is_one_byte) {
@@ -397,6 +425,93 @@ void RegExpImpl::IrregexpInitialize(Isolate* isolate, Handle<JSRegExp> re,
                                             flags, capture_count);
 }
 
+namespace {
+
+// Appends the literal that every match of {tree} starts with to {prefix}.
+// Returns true if {tree} matches exactly the appended characters, in which
+// case the caller may continue with the literal prefix of the next tree.
+bool AppendLiteralPrefix(RegExpTree* tree, ZoneList<uc16>* prefix,
+                         Zone* zone) {
+  if (tree->IsAtom()) {
+    RegExpAtom* atom = tree->AsAtom();
+    if (IgnoreCase(atom->flags())) return false;
+    for (uc16 c : atom->data()) prefix->Add(c, zone);
+    return true;
+  }
+  if (tree->IsText()) {
+    for (const TextElement& element : *tree->AsText()->elements()) {
+      if (element.text_type() != TextElement::ATOM) return false;
+      if (!AppendLiteralPrefix(element.atom(), prefix, zone)) return false;
+    }
+    return true;
+  }
+  if (tree->IsAlternative()) {
+    for (RegExpTree* node : *tree->AsAlternative()->nodes()) {
+      if (!AppendLiteralPrefix(node, prefix, zone)) return false;
+    }
+    return true;
+  }
+  if (tree->IsCapture()) {
+    return AppendLiteralPrefix(tree->AsCapture()->body(), prefix, zone);
+  }
+  if (tree->IsGroup()) {
+    return AppendLiteralPrefix(tree->AsGroup()->body(), prefix, zone);
+  }
+  if (tree->IsAssertion() || tree->IsLookaround()) {
+    // Zero-width, so the prefix continues with whatever follows.
+    return true;
+  }
+  if (tree->IsQuantifier() && tree->AsQuantifier()->min() > 0) {
+    AppendLiteralPrefix(tree->AsQuantifier()->body(), prefix, zone);
+    return false;
+  }
+  return false;
+}
+
+}  // namespace
+
+void RegExpImpl::IrregexpSetLiteralPrefix(Isolate* isolate,
+                                          Handle<JSRegExp> re,
+                                          RegExpTree* tree) {
+  Zone zone(isolate->allocator(), ZONE_NAME);
+  ZoneList<uc16> prefix(8, &zone);
+  AppendLiteralPrefix(tree, &prefix, &zone);
+  if (prefix.is_empty()) return;
+  Handle<String> prefix_string =
+      isolate->factory()
+          ->NewStringFromTwoByte(Vector<const uc16>(prefix.ToConstVector()))
+          .ToHandleChecked();
+  re->SetDataAt(JSRegExp::kIrregexpLiteralPrefixIndex, *prefix_string);
+}
+
+int RegExpImpl::IrregexpSkipToLiteralPrefix(Isolate* isolate, JSRegExp regexp,
+                                            String subject, int index) {
+  DisallowHeapAllocation no_gc;
+  Object prefix_object = regexp.DataAt(JSRegExp::kIrregexpLiteralPrefixIndex);
+  if (!prefix_object.IsString()) return index;
+  // The search uses memchr to find candidates for the first character, which
+  // the C library implements with vector instructions.
+  String::FlatContent prefix =
+      String::cast(prefix_object).GetFlatContent(no_gc);
+  String::FlatContent subject_content = subject.GetFlatContent(no_gc);
+  DCHECK(prefix.IsFlat());
+  DCHECK(subject_content.IsFlat());
+  if (subject_content.IsOneByte()) {
+    Vector<const uint8_t> subject_vector = subject_content.ToOneByteVector();
+    return prefix.IsOneByte()
+               ? SearchString(isolate, subject_vector,
+                              prefix.ToOneByteVector(), index)
+               : SearchString(isolate, subject_vector, prefix.ToUC16Vector(),
+                              index);
+  }
+  Vector<const uc16> subject_vector = subject_content.ToUC16Vector();
+  return prefix.IsOneByte()
+             ? SearchString(isolate, subject_vector, prefix.ToOneByteVector(),
+                            index)
+             : SearchString(isolate, subject_vector, prefix.ToUC16Vector(),
+                            index);
+}
+
 // static
 int RegExp::IrregexpPrepare(Isolate* isolate, Handle<JSRegExp> regexp,
                             Handle<String> subject) {
@@ -411,7 +526,7 @@ int RegExp::IrregexpPrepare(Isolate* isolate, Handle<JSRegExp> regexp,
 
   DisallowHeapAllocation no_gc;
   FixedArray data = FixedArray::cast(regexp->data());
-  if (FLAG_regexp_interpret_all) {
+  if (regexp->ShouldProduceBytecode()) {
     // Byte-code regexp needs space allocated for all its registers.
     // The result captures are copied to the start of the registers array
     // if the match succeeds.  This way those registers are not clobbered
@@ -436,7 +551,12 @@ int RegExpImpl::IrregexpExecRaw(Isolate* isolate, Handle<JSRegExp> regexp,
 
   bool is_one_byte = String::IsOneByteRepresentationUnderneath(*subject);
 
-  if (!FLAG_regexp_interpret_all) {
+  // Skip ahead to the first position where a match can start. This leaves
+  // {output} untouched on failure, just like a failed match below.
+  index = IrregexpSkipToLiteralPrefix(isolate, *regexp, *subject, index);
+  if (index < 0) return RegExp::RE_FAILURE;
+
+  if (!regexp->ShouldProduceBytecode()) {
     DCHECK(output_size >= (IrregexpNumberOfCaptures(*irregexp) + 1) * 2);
     do {
       EnsureCompiledIrregexp(isolate, regexp, subject, is_one_byte);
@@ -469,7 +589,7 @@ int RegExpImpl::IrregexpExecRaw(Isolate* isolate, Handle<JSRegExp> regexp,
     } while (true);
     UNREACHABLE();
   } else {
-    DCHECK(FLAG_regexp_interpret_all);
+    DCHECK(regexp->ShouldProduceBytecode());
     DCHECK(output_size >= IrregexpNumberOfRegisters(*irregexp));
     // We must have done EnsureCompiledIrregexp, so we can get the number of
     // registers.
@@ -522,12 +642,17 @@ MaybeHandle<Object> RegExpImpl::IrregexpExec(
 
   // Prepare space for the return values.
 #ifdef DEBUG
-  if (FLAG_regexp_interpret_all && FLAG_trace_regexp_bytecodes) {
+  if (regexp->ShouldProduceBytecode() && FLAG_trace_regexp_bytecodes) {
     String pattern = regexp->Pattern();
     PrintF("\n\nRegexp match:   /%s/\n\n", pattern.ToCString().get());
     PrintF("\n\nSubject string: '%s'\n\n", subject->ToCString().get());
   }
 #endif
+  if (FLAG_regexp_tier_up &&
+      subject->length() >= FLAG_regexp_tier_up_subject_length) {
+    // Native code pays off right away for long subjects.
+    regexp->MarkTierUpForNextExec();
+  }
   int required_registers = RegExp::IrregexpPrepare(isolate, regexp, subject);
   if (required_registers < 0) {
     // Compiling failed with an exception.
@@ -547,6 +672,7 @@ MaybeHandle<Object> RegExpImpl::IrregexpExec(
   int res =
       RegExpImpl::IrregexpExecRaw(isolate, regexp, subject, previous_index,
                                   output_registers, required_registers);
+  if (FLAG_regexp_tier_up) regexp->TierUpTick();
   if (res == RegExp::RE_SUCCESS) {
     int capture_count =
         IrregexpNumberOfCaptures(FixedArray::cast(regexp->data()));
@@ -630,12 +756,14 @@ bool RegExp::CompileForTesting(Isolate* isolate, Zone* zone,
                                Handle<String> sample_subject,
                                bool is_one_byte) {
   return RegExpImpl::Compile(isolate, zone, data, flags, pattern,
-                             sample_subject, is_one_byte);
+                             sample_subject, is_one_byte,
+                             FLAG_regexp_interpret_all);
 }
 
 bool RegExpImpl::Compile(Isolate* isolate, Zone* zone, RegExpCompileData* data,
                          JSRegExp::Flags flags, Handle<String> pattern,
-                         Handle<String> sample_subject, bool is_one_byte) {
+                         Handle<String> sample_subject, bool is_one_byte,
+                         bool use_bytecode) {
   if ((data->capture_count + 1) * 2 - 1 > RegExpMacroAssembler::kMaxRegister) {
     data->error =
         isolate->factory()->NewStringFromAsciiChecked("RegExp too big");
@@ -716,7 +844,7 @@ bool RegExpImpl::Compile(Isolate* isolate, Zone* zone, RegExpCompileData* data,
 
   // Create the correct assembler for the architecture.
   std::unique_ptr<RegExpMacroAssembler> macro_assembler;
-  if (!FLAG_regexp_interpret_all) {
+  if (!use_bytecode) {
     // Native regexp implementation.
     DCHECK(!FLAG_jitless);
 
@@ -752,7 +880,7 @@ bool RegExpImpl::Compile(Isolate* isolate, Zone* zone, RegExpCompileData* data,
 #error "Unsupported architecture"
 #endif
   } else {
-    DCHECK(FLAG_regexp_interpret_all);
+    DCHECK(use_bytecode);
 
     // Interpreted regexp implementation.
     macro_assembler.reset(new RegExpMacroAssemblerIrregexp(isolate, zone));
@@ -803,14 +931,24 @@ RegExpGlobalCache::RegExpGlobalCache(Handle<JSRegExp> regexp,
       regexp_(regexp),
       subject_(subject),
       isolate_(isolate) {
-  bool interpreted = FLAG_regexp_interpret_all;
+  bool interpreted = false;
 
   if (regexp_->TypeTag() == JSRegExp::ATOM) {
     static const int kAtomRegistersPerMatch = 2;
     registers_per_match_ = kAtomRegistersPerMatch;
     // There is no distinction between interpreted and native for atom regexps.
-    interpreted = false;
+  } else if (regexp_->TypeTag() == JSRegExp::EXPERIMENTAL) {
+    subject_ = String::Flatten(isolate_, subject_);
+    registers_per_match_ = ExperimentalRegExp::RegisterCount(*regexp_);
+    // Like the interpreter, the experimental engine finds one match at a
+    // time.
+    interpreted = true;
   } else {
+    if (FLAG_regexp_tier_up &&
+        subject_->length() >= FLAG_regexp_tier_up_subject_length) {
+      regexp_->MarkTierUpForNextExec();
+    }
+    interpreted = regexp_->ShouldProduceBytecode();
     registers_per_match_ = RegExp::IrregexpPrepare(isolate_, regexp_, subject_);
     if (registers_per_match_ < 0) {
       num_matches_ = -1;  // Signal exception.
@@ -854,6 +992,11 @@ RegExpGlobalCache::~RegExpGlobalCache() {
   if (register_array_size_ > Isolate::kJSRegexpStaticOffsetsVectorSize) {
     DeleteArray(register_array_);
   }
+  // A global operation counts as a single execution for tier-up. Ticking only
+  // at the end keeps the register layout stable during the operation.
+  if (FLAG_regexp_tier_up && regexp_->TypeTag() == JSRegExp::IRREGEXP) {
+    regexp_->TierUpTick();
+  }
 }
 
 int RegExpGlobalCache::AdvanceZeroLength(int last_index) {
@@ -884,6 +1027,18 @@ int32_t* RegExpGlobalCache::FetchNext() {
       num_matches_ =
           RegExpImpl::AtomExecRaw(isolate_, regexp_, subject_, last_end_index,
                                   register_array_, register_array_size_);
+    } else if (regexp_->TypeTag() == JSRegExp::EXPERIMENTAL) {
+      int last_start_index = last_match[0];
+      if (last_start_index == last_end_index) {
+        // Zero-length match. Advance by one code point.
+        last_end_index = AdvanceZeroLength(last_end_index);
+      }
+      if (last_end_index > subject_->length()) {
+        num_matches_ = 0;  // Signal failed match.
+        return nullptr;
+      }
+      num_matches_ = ExperimentalRegExp::ExecRaw(
+          isolate_, regexp_, subject_, last_end_index, register_array_);
     } else {
       int last_start_index = last_match[0];
       if (last_start_index == last_end_index) {
@@ -894,9 +1049,18 @@ int32_t* RegExpGlobalCache::FetchNext() {
         num_matches_ = 0;  // Signal failed match.
         return nullptr;
       }
-      num_matches_ = RegExpImpl::IrregexpExecRaw(
-          isolate_, regexp_, subject_, last_end_index, register_array_,
-          register_array_size_);
+      int output_size = register_array_size_;
+      int capture_registers = (regexp_->CaptureCount() + 1) * 2;
+      if (registers_per_match_ > capture_registers &&
+          !regexp_->ShouldProduceBytecode()) {
+        // The register array is laid out for the interpreter, but the regexp
+        // tiered up to native code in the meantime, e.g. from within a replace
+        // callback. Only let the native code produce a single match.
+        output_size = capture_registers;
+      }
+      num_matches_ = RegExpImpl::IrregexpExecRaw(isolate_, regexp_, subject_,
+                                                 last_end_index,
+                                                 register_array_, output_size);
     }
 
     if (num_matches_ <= 0) return nullptr;
@@ -50,9 +50,6 @@ struct RegExpCompileData {
 
 class RegExp final : public AllStatic {
  public:
-  // Whether the irregexp engine generates native code or interpreter bytecode.
-  static bool GeneratesNativeCode() { return !FLAG_regexp_interpret_all; }
-
   // Parses the RegExp pattern and prepares the JSRegExp object with
   // generic data and choice of implementation - as well as what
   // the implementation wants to store in the data field.
@@ -79,6 +76,11 @@ class RegExp final : public AllStatic {
     RE_EXCEPTION = kInternalRegExpException,
   };
 
+  // Generated code leaves matching of regexps with a literal prefix to the
+  // runtime, which skips ahead to candidate positions first, when at least
+  // this many characters are left in the subject.
+  static constexpr int kPrefixScanMinSubjectLength = 256;
+
   // Prepare a RegExp for being executed one or more times (using
   // IrregexpExecOnce) on the subject.
   // This ensures that the regexp is compiled for the subject, and that
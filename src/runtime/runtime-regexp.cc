@@ -322,7 +322,7 @@ bool CompiledReplacement::Compile(Isolate* isolate, Handle<JSRegExp> regexp,
 
     FixedArray capture_name_map;
     if (capture_count > 0) {
-      DCHECK_EQ(regexp->TypeTag(), JSRegExp::IRREGEXP);
+      DCHECK(JSRegExp::TypeSupportsCaptures(regexp->TypeTag()));
       Object maybe_capture_name_map = regexp->CaptureNameMap();
       if (maybe_capture_name_map.IsFixedArray()) {
         capture_name_map = FixedArray::cast(maybe_capture_name_map);
@@ -891,7 +891,7 @@ class MatchInfoBackedMatch : public String::Match {
       : isolate_(isolate), match_info_(match_info) {
     subject_ = String::Flatten(isolate, subject);
 
-    if (regexp->TypeTag() == JSRegExp::IRREGEXP) {
+    if (JSRegExp::TypeSupportsCaptures(regexp->TypeTag())) {
       Object o = regexp->CaptureNameMap();
       has_named_captures_ = o.IsFixedArray();
       if (has_named_captures_) {
@@ -1136,6 +1136,13 @@ static Object SearchRegExpMultiple(Isolate* isolate, Handle<String> subject,
   // Two smis before and after the match, for very long strings.
   static const int kMaxBuilderEntriesPerRegExpMatch = 5;
 
+  // Arguments array to replace function is match, captures, index and
+  // subject, i.e., 3 + capture count in total. If the RegExp contains
+  // named captures, they are also passed as the last argument.
+  Handle<Object> maybe_capture_map(regexp->CaptureNameMap(), isolate);
+  const bool has_named_captures = maybe_capture_map->IsFixedArray();
+  const int argc = has_named_captures ? 4 + capture_count : 3 + capture_count;
+
   while (true) {
     int32_t* current_match = global_cache.FetchNext();
     if (current_match == nullptr) break;
@@ -1160,16 +1167,6 @@ static Object SearchRegExpMultiple(Isolate* isolate, Handle<String> subject,
       }
 
       if (has_capture) {
-        // Arguments array to replace function is match, captures, index and
-        // subject, i.e., 3 + capture count in total. If the RegExp contains
-        // named captures, they are also passed as the last argument.
-
-        Handle<Object> maybe_capture_map(regexp->CaptureNameMap(), isolate);
-        const bool has_named_captures = maybe_capture_map->IsFixedArray();
-
-        const int argc =
-            has_named_captures ? 4 + capture_count : 3 + capture_count;
-
         Handle<FixedArray> elements = isolate->factory()->NewFixedArray(argc);
         int cursor = 0;
 
@@ -1200,7 +1197,10 @@ static Object SearchRegExpMultiple(Isolate* isolate, Handle<String> subject,
         }
 
         DCHECK_EQ(cursor, argc);
-        builder.Add(*isolate->factory()->NewJSArrayWithElements(elements));
+        // The arguments are stored as a plain FixedArray, which the replace
+        // builtin passes to the replace function without any further
+        // allocation. The result array never escapes to JavaScript.
+        builder.Add(*elements);
       } else {
         builder.Add(*match);
       }
@@ -1444,8 +1444,8 @@ RUNTIME_FUNCTION(Runtime_StringReplaceNonGlobalRegExpWithFunction) {
   bool has_named_captures = false;
   Handle<FixedArray> capture_map;
   if (m > 1) {
-    // The existence of capture groups implies IRREGEXP kind.
-    DCHECK_EQ(regexp->TypeTag(), JSRegExp::IRREGEXP);
+    // The existence of capture groups implies IRREGEXP or EXPERIMENTAL kind.
+    DCHECK(JSRegExp::TypeSupportsCaptures(regexp->TypeTag()));
 
     Object maybe_capture_map = regexp->CaptureNameMap();
     if (maybe_capture_map.IsFixedArray()) {
@@ -986,7 +986,10 @@ RUNTIME_FUNCTION(Runtime_IsWasmCode) {
   SealHandleScope shs(isolate);
   DCHECK_EQ(1, args.length());
   CONVERT_ARG_CHECKED(JSFunction, function, 0);
-  bool is_js_to_wasm = function.code().kind() == Code::JS_TO_WASM_FUNCTION;
+  Code code = function.code();
+  bool is_js_to_wasm =
+      code.kind() == Code::JS_TO_WASM_FUNCTION ||
+      code.builtin_index() == Builtins::kWasmCompileJSToWasmWrapperLazy;
   return isolate->heap()->ToBoolean(is_js_to_wasm);
 }
 
@@ -1280,6 +1283,26 @@ RUNTIME_FUNCTION(Runtime_IsLiftoffFunction) {
   return isolate->heap()->ToBoolean(code && code->is_liftoff());
 }
 
+RUNTIME_FUNCTION(Runtime_IsWasmFunctionCompiled) {
+  HandleScope scope(isolate);
+  DCHECK_EQ(1, args.length());
+  CONVERT_ARG_HANDLE_CHECKED(JSFunction, function, 0);
+  CHECK(WasmExportedFunction::IsWasmExportedFunction(*function));
+  Handle<WasmExportedFunction> exp_fun =
+      Handle<WasmExportedFunction>::cast(function);
+  wasm::NativeModule* native_module =
+      exp_fun->instance().module_object().native_module();
+  return isolate->heap()->ToBoolean(
+      native_module->HasCode(exp_fun->function_index()));
+}
+
+RUNTIME_FUNCTION(Runtime_WasmAgeCode) {
+  DCHECK_EQ(0, args.length());
+  CHECK(FLAG_wasm_code_aging);
+  isolate->wasm_engine()->AgeCodeForTesting();
+  return ReadOnlyRoots(isolate).undefined_value();
+}
+
 RUNTIME_FUNCTION(Runtime_CompleteInobjectSlackTracking) {
   HandleScope scope(isolate);
   DCHECK_EQ(1, args.length());
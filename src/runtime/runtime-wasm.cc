@@ -340,6 +340,17 @@ RUNTIME_FUNCTION(Runtime_WasmCompileLazy) {
   return Object(entrypoint);
 }
 
+// Called from the WasmCompileJSToWasmWrapperLazy builtin on the first call of
+// an exported function whose wrapper has not been compiled yet.
+RUNTIME_FUNCTION(Runtime_WasmCompileJSToWasmWrapper) {
+  HandleScope scope(isolate);
+  DCHECK_EQ(1, args.length());
+  CONVERT_ARG_HANDLE_CHECKED(JSFunction, function, 0);
+  DCHECK(WasmExportedFunction::IsWasmExportedFunction(*function));
+  return *WasmExportedFunction::EnsureExportWrapper(
+      isolate, Handle<WasmExportedFunction>::cast(function));
+}
+
 // Should be called from within a handle scope
 Handle<JSArrayBuffer> getSharedArrayBuffer(Handle<WasmInstanceObject> instance,
                                            Isolate* isolate, uint32_t address) {
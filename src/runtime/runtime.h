@@ -492,6 +492,7 @@ namespace internal {
   F(IsLiftoffFunction, 1, 1)                  \
   F(IsThreadInWasm, 0, 1)                     \
   F(IsWasmCode, 1, 1)                         \
+  F(IsWasmFunctionCompiled, 1, 1)             \
   F(IsWasmTrapHandlerEnabled, 0, 1)           \
   F(MapIteratorProtector, 0, 1)               \
   F(NeverOptimizeFunction, 1, 1)              \
@@ -515,6 +516,7 @@ namespace internal {
   F(TraceExit, 1, 1)                          \
   F(TurbofanStaticAssert, 1, 1)               \
   F(UnblockConcurrentRecompilation, 0, 1)     \
+  F(WasmAgeCode, 0, 1)                        \
   F(WasmGetNumberOfInstances, 1, 1)           \
   F(WasmNumInterpretedCalls, 1, 1)            \
   F(WasmTierUpFunction, 2, 1)                 \
@@ -549,7 +551,8 @@ namespace internal {
   F(WasmTableGrow, 3, 1)              \
   F(WasmTableFill, 4, 1)              \
   F(WasmIsValidFuncRefValue, 1, 1)    \
-  F(WasmCompileLazy, 2, 1)
+  F(WasmCompileLazy, 2, 1)            \
+  F(WasmCompileJSToWasmWrapper, 1, 1)
 
 #define FOR_EACH_INTRINSIC_RETURN_PAIR_IMPL(F, I) \
   F(DebugBreakOnBytecode, 1, 2)                   \
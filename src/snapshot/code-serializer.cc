@@ -4,6 +4,7 @@
 
 #include "src/snapshot/code-serializer.h"
 
+#include "src/codegen/compiler.h"
 #include "src/codegen/macro-assembler.h"
 #include "src/debug/debug.h"
 #include "src/heap/heap-inl.h"
@@ -35,6 +36,29 @@ CodeSerializer::CodeSerializer(Isolate* isolate, uint32_t source_hash)
   allocator()->UseCustomChunkSize(FLAG_serialization_chunk_size);
 }
 
+namespace {
+
+// Compiles the functions of |script| that were recorded during a code cache
+// warm-up but have been flushed since, so that the cache includes them.
+void CompileWarmUpFunctions(Isolate* isolate, Handle<Script> script) {
+  Handle<WeakArrayList> recorded;
+  if (!isolate->code_cache_warm_up_functions().ToHandle(&recorded)) return;
+  // Compiling may record more functions and replace the global handle.
+  Handle<WeakArrayList> list = handle(*recorded, isolate);
+  for (int i = 0; i < list->length(); i++) {
+    HeapObject heap_object;
+    if (!list->Get(i)->GetHeapObjectIfWeak(&heap_object)) continue;
+    SharedFunctionInfo shared = SharedFunctionInfo::cast(heap_object);
+    if (shared.script() != *script || shared.is_compiled()) continue;
+    HandleScope scope(isolate);
+    IsCompiledScope is_compiled_scope;
+    Compiler::Compile(handle(shared, isolate), Compiler::CLEAR_EXCEPTION,
+                      &is_compiled_scope);
+  }
+}
+
+}  // namespace
+
 // static
 ScriptCompiler::CachedData* CodeSerializer::Serialize(
     Handle<SharedFunctionInfo> info) {
@@ -57,6 +81,8 @@ ScriptCompiler::CachedData* CodeSerializer::Serialize(
   // context independent.
   if (script->ContainsAsmModule()) return nullptr;
 
+  CompileWarmUpFunctions(isolate, script);
+
   // Serialize code object.
   Handle<String> source(String::cast(script->source()), isolate);
   CodeSerializer cs(isolate, SerializedCodeData::SourceHash(
@@ -281,6 +307,7 @@ MaybeHandle<SharedFunctionInfo> CodeSerializer::Deserialize(
     DCHECK(cached_data->rejected());
     isolate->counters()->code_cache_reject_reason()->AddSample(
         sanity_check_result);
+    isolate->set_code_cache_rejects(isolate->code_cache_rejects() + 1);
     return MaybeHandle<SharedFunctionInfo>();
   }
 
@@ -292,8 +319,10 @@ MaybeHandle<SharedFunctionInfo> CodeSerializer::Deserialize(
   if (!maybe_result.ToHandle(&result)) {
     // Deserializing may fail if the reservations cannot be fulfilled.
     if (FLAG_profile_deserialization) PrintF("[Deserializing failed]\n");
+    isolate->set_code_cache_rejects(isolate->code_cache_rejects() + 1);
     return MaybeHandle<SharedFunctionInfo>();
   }
+  isolate->set_code_cache_hits(isolate->code_cache_hits() + 1);
 
   if (FLAG_profile_deserialization) {
     double ms = timer.Elapsed().InMillisecondsF();
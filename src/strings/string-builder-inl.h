@@ -115,8 +115,26 @@ class ReplacementStringBuilder {
 
 class IncrementalStringBuilder {
  public:
+  // Receives the contents of a builder that streams its result instead of
+  // accumulating it into a string. Chunks are passed in order, and must not
+  // be retained or cause heap allocation.
+  class Sink {
+   public:
+    virtual ~Sink() = default;
+    virtual void Write(Vector<const uint8_t> chars) = 0;
+    virtual void Write(Vector<const uc16> chars) = 0;
+  };
+
   explicit IncrementalStringBuilder(Isolate* isolate);
 
+  // Streams completed parts to {sink} instead of accumulating them, reusing
+  // the current part where possible. Finish() then writes out the last part
+  // and returns the empty string.
+  void set_sink(Sink* sink) {
+    DCHECK_EQ(0, Length());
+    sink_ = sink;
+  }
+
   V8_INLINE String::Encoding CurrentEncoding() { return encoding_; }
 
   template <typename SrcChar, typename DestChar>
@@ -271,8 +289,9 @@ class IncrementalStringBuilder {
     *current_part_.location() = string->ptr();
   }
 
-  // Add the current part to the accumulator.
+  // Add the current part to the accumulator, or write it to the sink.
   void Accumulate(Handle<String> new_part);
+  void WriteToSink(Handle<String> part);
 
   // Finish the current part and allocate a new part.
   void Extend();
@@ -299,6 +318,7 @@ class IncrementalStringBuilder {
   int current_index_;
   Handle<String> accumulator_;
   Handle<String> current_part_;
+  Sink* sink_;
 };
 
 template <typename SrcChar, typename DestChar>
@@ -233,7 +233,8 @@ IncrementalStringBuilder::IncrementalStringBuilder(Isolate* isolate)
       encoding_(String::ONE_BYTE_ENCODING),
       overflowed_(false),
       part_length_(kInitialPartLength),
-      current_index_(0) {
+      current_index_(0),
+      sink_(nullptr) {
   // Create an accumulator handle starting with the empty string.
   accumulator_ =
       Handle<String>::New(ReadOnlyRoots(isolate).empty_string(), isolate);
@@ -246,6 +247,10 @@ int IncrementalStringBuilder::Length() const {
 }
 
 void IncrementalStringBuilder::Accumulate(Handle<String> new_part) {
+  if (sink_ != nullptr) {
+    WriteToSink(new_part);
+    return;
+  }
   Handle<String> new_accumulator;
   if (accumulator()->length() + new_part->length() > String::kMaxLength) {
     // Set the flag and carry on. Delay throwing the exception till the end.
@@ -264,6 +269,14 @@ void IncrementalStringBuilder::Extend() {
   if (part_length_ <= kMaxPartLength / kPartLengthGrowthFactor) {
     part_length_ *= kPartLengthGrowthFactor;
   }
+  // The contents of a full part have been written out to the sink, so the
+  // part can be filled again once it has reached the maximum length.
+  if (sink_ != nullptr && current_part()->length() == part_length_ &&
+      current_part()->IsOneByteRepresentation() ==
+          (encoding_ == String::ONE_BYTE_ENCODING)) {
+    current_index_ = 0;
+    return;
+  }
   Handle<String> new_part;
   if (encoding_ == String::ONE_BYTE_ENCODING) {
     new_part = factory()->NewRawOneByteString(part_length_).ToHandleChecked();
@@ -275,6 +288,19 @@ void IncrementalStringBuilder::Extend() {
   current_index_ = 0;
 }
 
+void IncrementalStringBuilder::WriteToSink(Handle<String> part) {
+  part = String::Flatten(isolate_, part);
+  DisallowHeapAllocation no_gc;
+  String::FlatContent content = part->GetFlatContent(no_gc);
+  if (content.IsOneByte()) {
+    Vector<const uint8_t> chars = content.ToOneByteVector();
+    if (!chars.empty()) sink_->Write(chars);
+  } else {
+    Vector<const uc16> chars = content.ToUC16Vector();
+    if (!chars.empty()) sink_->Write(chars);
+  }
+}
+
 MaybeHandle<String> IncrementalStringBuilder::Finish() {
   ShrinkCurrentPart();
   Accumulate(current_part());
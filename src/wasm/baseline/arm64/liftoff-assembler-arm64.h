@@ -40,12 +40,12 @@ namespace liftoff {
 //
 
 constexpr int32_t kInstanceOffset = 2 * kSystemPointerSize;
-constexpr int32_t kFirstStackSlotOffset = kInstanceOffset + kSystemPointerSize;
 constexpr int32_t kConstantStackSpace = 0;
 
-inline MemOperand GetStackSlot(uint32_t index) {
-  int32_t offset =
-      kFirstStackSlotOffset + index * LiftoffAssembler::kStackSlotSize;
+// Frame slots are {LiftoffAssembler::kSimd128StackSlotSize} bytes wide if the
+// function can hold s128 values.
+inline MemOperand GetStackSlot(LiftoffAssembler* assm, uint32_t index) {
+  int32_t offset = kInstanceOffset + (index + 1) * assm->stack_slot_size();
   return MemOperand(fp, -offset);
 }
 
@@ -63,6 +63,8 @@ inline CPURegister GetRegFromType(const LiftoffRegister& reg, ValueType type) {
       return reg.fp().S();
     case kWasmF64:
       return reg.fp().D();
+    case kWasmS128:
+      return reg.fp().Q();
     default:
       UNREACHABLE();
   }
@@ -73,9 +75,9 @@ inline CPURegList PadRegList(RegList list) {
   return CPURegList(CPURegister::kRegister, kXRegSizeInBits, list);
 }
 
-inline CPURegList PadVRegList(RegList list) {
+inline CPURegList PadVRegList(RegList list, int reg_size_in_bits) {
   if ((base::bits::CountPopulation(list) & 1) != 0) list |= fp_scratch.bit();
-  return CPURegList(CPURegister::kVRegister, kDRegSizeInBits, list);
+  return CPURegList(CPURegister::kVRegister, reg_size_in_bits, list);
 }
 
 inline CPURegister AcquireByType(UseScratchRegisterScope* temps,
@@ -89,6 +91,8 @@ inline CPURegister AcquireByType(UseScratchRegisterScope* temps,
       return temps->AcquireS();
     case kWasmF64:
       return temps->AcquireD();
+    case kWasmS128:
+      return temps->AcquireQ();
     default:
       UNREACHABLE();
   }
@@ -123,6 +127,8 @@ void LiftoffAssembler::PatchPrepareStackFrame(int offset,
                                               uint32_t stack_slots) {
   static_assert(kStackSlotSize == kXRegSize,
                 "kStackSlotSize must equal kXRegSize");
+  // {stack_slots} is given in units of {kStackSlotSize}, see
+  // {GetTotalFrameSlotCount}.
   uint32_t bytes = liftoff::kConstantStackSpace + kStackSlotSize * stack_slots;
   // The stack pointer is required to be quadword aligned.
   // Misalignment will cause a stack alignment fault.
@@ -276,6 +282,9 @@ void LiftoffAssembler::Load(LiftoffRegister dst, Register src_addr,
     case LoadType::kF64Load:
       Ldr(dst.fp().D(), src_op);
       break;
+    case LoadType::kS128Load:
+      Ldr(dst.fp().Q(), src_op);
+      break;
     default:
       UNREACHABLE();
   }
@@ -311,6 +320,9 @@ void LiftoffAssembler::Store(Register dst_addr, Register offset_reg,
     case StoreType::kF64Store:
       Str(src.fp().D(), dst_op);
       break;
+    case StoreType::kS128Store:
+      Str(src.fp().Q(), dst_op);
+      break;
     default:
       UNREACHABLE();
   }
@@ -327,8 +339,8 @@ void LiftoffAssembler::MoveStackValue(uint32_t dst_index, uint32_t src_index,
                                       ValueType type) {
   UseScratchRegisterScope temps(this);
   CPURegister scratch = liftoff::AcquireByType(&temps, type);
-  Ldr(scratch, liftoff::GetStackSlot(src_index));
-  Str(scratch, liftoff::GetStackSlot(dst_index));
+  Ldr(scratch, liftoff::GetStackSlot(this, src_index));
+  Str(scratch, liftoff::GetStackSlot(this, dst_index));
 }
 
 void LiftoffAssembler::Move(Register dst, Register src, ValueType type) {
@@ -344,22 +356,24 @@ void LiftoffAssembler::Move(DoubleRegister dst, DoubleRegister src,
                             ValueType type) {
   if (type == kWasmF32) {
     Fmov(dst.S(), src.S());
-  } else {
-    DCHECK_EQ(kWasmF64, type);
+  } else if (type == kWasmF64) {
     Fmov(dst.D(), src.D());
+  } else {
+    DCHECK_EQ(kWasmS128, type);
+    Mov(dst.Q(), src.Q());
   }
 }
 
 void LiftoffAssembler::Spill(uint32_t index, LiftoffRegister reg,
                              ValueType type) {
   RecordUsedSpillSlot(index);
-  MemOperand dst = liftoff::GetStackSlot(index);
+  MemOperand dst = liftoff::GetStackSlot(this, index);
   Str(liftoff::GetRegFromType(reg, type), dst);
 }
 
 void LiftoffAssembler::Spill(uint32_t index, WasmValue value) {
   RecordUsedSpillSlot(index);
-  MemOperand dst = liftoff::GetStackSlot(index);
+  MemOperand dst = liftoff::GetStackSlot(this, index);
   UseScratchRegisterScope temps(this);
   CPURegister src = CPURegister::no_reg();
   switch (value.type()) {
@@ -388,7 +402,7 @@ void LiftoffAssembler::Spill(uint32_t index, WasmValue value) {
 
 void LiftoffAssembler::Fill(LiftoffRegister reg, uint32_t index,
                             ValueType type) {
-  MemOperand src = liftoff::GetStackSlot(index);
+  MemOperand src = liftoff::GetStackSlot(this, index);
   Ldr(liftoff::GetRegFromType(reg, type), src);
 }
 
@@ -869,6 +883,77 @@ void LiftoffAssembler::emit_i64_signextend_i32(LiftoffRegister dst,
   sxtw(dst.gp(), src.gp());
 }
 
+void LiftoffAssembler::emit_i32x4_splat(LiftoffRegister dst,
+                                        LiftoffRegister src) {
+  Dup(dst.fp().V4S(), src.gp().W());
+}
+
+void LiftoffAssembler::emit_f32x4_splat(LiftoffRegister dst,
+                                        LiftoffRegister src) {
+  Dup(dst.fp().V4S(), src.fp().S(), 0);
+}
+
+void LiftoffAssembler::emit_i32x4_extract_lane(LiftoffRegister dst,
+                                               LiftoffRegister lhs,
+                                               uint8_t imm_lane_idx) {
+  Mov(dst.gp().W(), lhs.fp().V4S(), imm_lane_idx);
+}
+
+void LiftoffAssembler::emit_f32x4_extract_lane(LiftoffRegister dst,
+                                               LiftoffRegister lhs,
+                                               uint8_t imm_lane_idx) {
+  Mov(dst.fp().S(), lhs.fp().V4S(), imm_lane_idx);
+}
+
+void LiftoffAssembler::emit_i32x4_replace_lane(LiftoffRegister dst,
+                                               LiftoffRegister src1,
+                                               LiftoffRegister src2,
+                                               uint8_t imm_lane_idx) {
+  if (dst != src1) Mov(dst.fp().V4S(), src1.fp().V4S());
+  Mov(dst.fp().V4S(), imm_lane_idx, src2.gp().W());
+}
+
+void LiftoffAssembler::emit_f32x4_replace_lane(LiftoffRegister dst,
+                                               LiftoffRegister src1,
+                                               LiftoffRegister src2,
+                                               uint8_t imm_lane_idx) {
+  UseScratchRegisterScope temps(this);
+  VRegister value = src2.fp().V4S();
+  if (dst == src2 && dst != src1) {
+    value = temps.AcquireQ().V4S();
+    Mov(value, src2.fp().V4S());
+  }
+  if (dst != src1) Mov(dst.fp().V4S(), src1.fp().V4S());
+  Mov(dst.fp().V4S(), imm_lane_idx, value, 0);
+}
+
+#define SIMD_BINOP(name, instruction, format)                                  \
+  void LiftoffAssembler::emit_##name(LiftoffRegister dst, LiftoffRegister lhs, \
+                                     LiftoffRegister rhs) {                    \
+    instruction(dst.fp().format(), lhs.fp().format(), rhs.fp().format());      \
+  }
+
+SIMD_BINOP(i8x16_add, Add, V16B)
+SIMD_BINOP(i8x16_sub, Sub, V16B)
+SIMD_BINOP(i16x8_add, Add, V8H)
+SIMD_BINOP(i16x8_sub, Sub, V8H)
+SIMD_BINOP(i32x4_add, Add, V4S)
+SIMD_BINOP(i32x4_sub, Sub, V4S)
+SIMD_BINOP(i32x4_mul, Mul, V4S)
+SIMD_BINOP(f32x4_add, Fadd, V4S)
+SIMD_BINOP(f32x4_sub, Fsub, V4S)
+SIMD_BINOP(f32x4_mul, Fmul, V4S)
+SIMD_BINOP(s128_and, And, V16B)
+SIMD_BINOP(s128_or, Orr, V16B)
+SIMD_BINOP(s128_xor, Eor, V16B)
+
+#undef SIMD_BINOP
+
+void LiftoffAssembler::emit_s128_not(LiftoffRegister dst,
+                                     LiftoffRegister src) {
+  Mvn(dst.fp().V16B(), src.fp().V16B());
+}
+
 void LiftoffAssembler::emit_jump(Label* label) { B(label); }
 
 void LiftoffAssembler::emit_jump(Register target) { Br(target); }
@@ -957,12 +1042,15 @@ void LiftoffAssembler::AssertUnreachable(AbortReason reason) {
 }
 
 void LiftoffAssembler::PushRegisters(LiftoffRegList regs) {
+  // Preserve the full 128 bits if the registers can hold s128 values.
+  int fp_reg_size_in_bits = stack_slot_size() * kBitsPerByte;
   PushCPURegList(liftoff::PadRegList(regs.GetGpList()));
-  PushCPURegList(liftoff::PadVRegList(regs.GetFpList()));
+  PushCPURegList(liftoff::PadVRegList(regs.GetFpList(), fp_reg_size_in_bits));
 }
 
 void LiftoffAssembler::PopRegisters(LiftoffRegList regs) {
-  PopCPURegList(liftoff::PadVRegList(regs.GetFpList()));
+  int fp_reg_size_in_bits = stack_slot_size() * kBitsPerByte;
+  PopCPURegList(liftoff::PadVRegList(regs.GetFpList(), fp_reg_size_in_bits));
   PopCPURegList(liftoff::PadRegList(regs.GetGpList()));
 }
 
@@ -1057,7 +1145,7 @@ void LiftoffStackSlots::Construct() {
       case LiftoffAssembler::VarState::kStack: {
         UseScratchRegisterScope temps(asm_);
         CPURegister scratch = liftoff::AcquireByType(&temps, slot.src_.type());
-        asm_->Ldr(scratch, liftoff::GetStackSlot(slot.src_index_));
+        asm_->Ldr(scratch, liftoff::GetStackSlot(asm_, slot.src_index_));
         asm_->Poke(scratch, poke_offset);
         break;
       }
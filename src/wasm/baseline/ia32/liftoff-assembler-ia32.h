@@ -1531,6 +1531,69 @@ void LiftoffAssembler::emit_i64_signextend_i32(LiftoffRegister dst,
   liftoff::SignExtendI32ToI64(this, dst);
 }
 
+void LiftoffAssembler::emit_i32x4_splat(LiftoffRegister dst,
+                                        LiftoffRegister src) {
+  bailout(kSimd, "i32x4_splat");
+}
+
+void LiftoffAssembler::emit_f32x4_splat(LiftoffRegister dst,
+                                        LiftoffRegister src) {
+  bailout(kSimd, "f32x4_splat");
+}
+
+void LiftoffAssembler::emit_i32x4_extract_lane(LiftoffRegister dst,
+                                               LiftoffRegister lhs,
+                                               uint8_t imm_lane_idx) {
+  bailout(kSimd, "i32x4_extract_lane");
+}
+
+void LiftoffAssembler::emit_f32x4_extract_lane(LiftoffRegister dst,
+                                               LiftoffRegister lhs,
+                                               uint8_t imm_lane_idx) {
+  bailout(kSimd, "f32x4_extract_lane");
+}
+
+void LiftoffAssembler::emit_i32x4_replace_lane(LiftoffRegister dst,
+                                               LiftoffRegister src1,
+                                               LiftoffRegister src2,
+                                               uint8_t imm_lane_idx) {
+  bailout(kSimd, "i32x4_replace_lane");
+}
+
+void LiftoffAssembler::emit_f32x4_replace_lane(LiftoffRegister dst,
+                                               LiftoffRegister src1,
+                                               LiftoffRegister src2,
+                                               uint8_t imm_lane_idx) {
+  bailout(kSimd, "f32x4_replace_lane");
+}
+
+#define UNIMPLEMENTED_SIMD_BINOP(name)                                         \
+  void LiftoffAssembler::emit_##name(LiftoffRegister dst, LiftoffRegister lhs, \
+                                     LiftoffRegister rhs) {                    \
+    bailout(kSimd, "simd binop: " #name);                                      \
+  }
+
+UNIMPLEMENTED_SIMD_BINOP(i8x16_add)
+UNIMPLEMENTED_SIMD_BINOP(i8x16_sub)
+UNIMPLEMENTED_SIMD_BINOP(i16x8_add)
+UNIMPLEMENTED_SIMD_BINOP(i16x8_sub)
+UNIMPLEMENTED_SIMD_BINOP(i32x4_add)
+UNIMPLEMENTED_SIMD_BINOP(i32x4_sub)
+UNIMPLEMENTED_SIMD_BINOP(i32x4_mul)
+UNIMPLEMENTED_SIMD_BINOP(f32x4_add)
+UNIMPLEMENTED_SIMD_BINOP(f32x4_sub)
+UNIMPLEMENTED_SIMD_BINOP(f32x4_mul)
+UNIMPLEMENTED_SIMD_BINOP(s128_and)
+UNIMPLEMENTED_SIMD_BINOP(s128_or)
+UNIMPLEMENTED_SIMD_BINOP(s128_xor)
+
+#undef UNIMPLEMENTED_SIMD_BINOP
+
+void LiftoffAssembler::emit_s128_not(LiftoffRegister dst,
+                                     LiftoffRegister src) {
+  bailout(kSimd, "s128_not");
+}
+
 void LiftoffAssembler::emit_jump(Label* label) { jmp(label); }
 
 void LiftoffAssembler::emit_jump(Register target) { jmp(target); }
@@ -175,10 +175,13 @@ class StackTransferRecipe {
       DCHECK_EQ(register_move(dst)->src, src);
       // Non-fp registers can only occur with the exact same type.
       DCHECK_IMPLIES(!dst.is_fp(), register_move(dst)->type == type);
-      // It can happen that one fp register holds both the f32 zero and the f64
-      // zero, as the initial value for local variables. Move the value as f64
-      // in that case.
-      if (type == kWasmF64) register_move(dst)->type = kWasmF64;
+      // It can happen that one fp register holds the f32, f64 and s128 zero
+      // as the initial value for local variables. Move the value with the
+      // widest type in that case.
+      if (ValueTypes::ElementSizeInBytes(type) >
+          ValueTypes::ElementSizeInBytes(register_move(dst)->type)) {
+        register_move(dst)->type = type;
+      }
       return;
     }
     move_dst_regs_.set(dst);
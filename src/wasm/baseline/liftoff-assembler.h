@@ -33,8 +33,10 @@ namespace wasm {
 
 class LiftoffAssembler : public TurboAssembler {
  public:
-  // Each slot in our stack frame currently has exactly 8 bytes.
+  // Each slot in our stack frame has exactly 8 bytes, unless the function can
+  // hold s128 values; then all slots are {kSimd128StackSlotSize} bytes wide.
   static constexpr uint32_t kStackSlotSize = 8;
+  static constexpr uint32_t kSimd128StackSlotSize = 16;
 
   static constexpr ValueType kWasmIntPtr =
       kSystemPointerSize == 8 ? kWasmI64 : kWasmI32;
@@ -561,6 +563,47 @@ class LiftoffAssembler : public TurboAssembler {
   inline void emit_i64_signextend_i16(LiftoffRegister dst, LiftoffRegister src);
   inline void emit_i64_signextend_i32(LiftoffRegister dst, LiftoffRegister src);
 
+  // s128 operations. Only called if {kLiftoffSupportsSimd128} holds.
+  inline void emit_i32x4_splat(LiftoffRegister dst, LiftoffRegister src);
+  inline void emit_f32x4_splat(LiftoffRegister dst, LiftoffRegister src);
+  inline void emit_i32x4_extract_lane(LiftoffRegister dst, LiftoffRegister lhs,
+                                      uint8_t imm_lane_idx);
+  inline void emit_f32x4_extract_lane(LiftoffRegister dst, LiftoffRegister lhs,
+                                      uint8_t imm_lane_idx);
+  inline void emit_i32x4_replace_lane(LiftoffRegister dst, LiftoffRegister src1,
+                                      LiftoffRegister src2,
+                                      uint8_t imm_lane_idx);
+  inline void emit_f32x4_replace_lane(LiftoffRegister dst, LiftoffRegister src1,
+                                      LiftoffRegister src2,
+                                      uint8_t imm_lane_idx);
+  inline void emit_i8x16_add(LiftoffRegister dst, LiftoffRegister lhs,
+                             LiftoffRegister rhs);
+  inline void emit_i8x16_sub(LiftoffRegister dst, LiftoffRegister lhs,
+                             LiftoffRegister rhs);
+  inline void emit_i16x8_add(LiftoffRegister dst, LiftoffRegister lhs,
+                             LiftoffRegister rhs);
+  inline void emit_i16x8_sub(LiftoffRegister dst, LiftoffRegister lhs,
+                             LiftoffRegister rhs);
+  inline void emit_i32x4_add(LiftoffRegister dst, LiftoffRegister lhs,
+                             LiftoffRegister rhs);
+  inline void emit_i32x4_sub(LiftoffRegister dst, LiftoffRegister lhs,
+                             LiftoffRegister rhs);
+  inline void emit_i32x4_mul(LiftoffRegister dst, LiftoffRegister lhs,
+                             LiftoffRegister rhs);
+  inline void emit_f32x4_add(LiftoffRegister dst, LiftoffRegister lhs,
+                             LiftoffRegister rhs);
+  inline void emit_f32x4_sub(LiftoffRegister dst, LiftoffRegister lhs,
+                             LiftoffRegister rhs);
+  inline void emit_f32x4_mul(LiftoffRegister dst, LiftoffRegister lhs,
+                             LiftoffRegister rhs);
+  inline void emit_s128_and(LiftoffRegister dst, LiftoffRegister lhs,
+                            LiftoffRegister rhs);
+  inline void emit_s128_or(LiftoffRegister dst, LiftoffRegister lhs,
+                           LiftoffRegister rhs);
+  inline void emit_s128_xor(LiftoffRegister dst, LiftoffRegister lhs,
+                            LiftoffRegister rhs);
+  inline void emit_s128_not(LiftoffRegister dst, LiftoffRegister src);
+
   inline void emit_jump(Label*);
   inline void emit_jump(Register);
 
@@ -616,8 +659,18 @@ class LiftoffAssembler : public TurboAssembler {
   uint32_t num_locals() const { return num_locals_; }
   void set_num_locals(uint32_t num_locals);
 
+  // Returns the frame size in units of {kStackSlotSize}.
   uint32_t GetTotalFrameSlotCount() const {
-    return num_locals_ + num_used_spill_slots_;
+    return (num_locals_ + num_used_spill_slots_) *
+           (stack_slot_size_ / kStackSlotSize);
+  }
+
+  uint32_t stack_slot_size() const { return stack_slot_size_; }
+  void set_stack_slot_size(uint32_t stack_slot_size) {
+    DCHECK(stack_slot_size == kStackSlotSize ||
+           (kLiftoffSupportsSimd128 &&
+            stack_slot_size == kSimd128StackSlotSize));
+    stack_slot_size_ = stack_slot_size;
   }
 
   ValueType local_type(uint32_t index) {
@@ -659,6 +712,7 @@ class LiftoffAssembler : public TurboAssembler {
                 "Reconsider this inlining if ValueType gets bigger");
   CacheState cache_state_;
   uint32_t num_used_spill_slots_ = 0;
+  uint32_t stack_slot_size_ = kStackSlotSize;
   LiftoffBailoutReason bailout_reason_ = kSuccess;
   const char* bailout_detail_ = nullptr;
 
@@ -119,6 +119,20 @@ constexpr ValueType kSupportedTypesArr[] = {kWasmI32, kWasmI64, kWasmF32,
 constexpr Vector<const ValueType> kSupportedTypes =
     ArrayVector(kSupportedTypesArr);
 
+constexpr ValueType kSupportedTypesWithSimdArr[] = {
+    kWasmI32, kWasmI64, kWasmF32, kWasmF64, kWasmS128};
+constexpr Vector<const ValueType> kSupportedTypesWithSimd =
+    ArrayVector(kSupportedTypesWithSimdArr);
+
+// s128 values are supported inside of function bodies if the platform has a
+// Liftoff implementation and the CPU supports the needed instructions. They
+// are not passed across calls yet.
+bool SupportsSimd128(const CompilationEnv* env) {
+  return kLiftoffSupportsSimd128 && env->enabled_features.simd &&
+         env->lower_simd == kNoLowerSimd &&
+         CpuFeatures::SupportsWasmSimd128();
+}
+
 class LiftoffCompiler {
  public:
   // TODO(clemensh): Make this a template parameter.
@@ -171,6 +185,7 @@ class LiftoffCompiler {
         descriptor_(
             GetLoweredCallDescriptor(compilation_zone, call_descriptor)),
         env_(env),
+        supports_simd128_(SupportsSimd128(env)),
         compilation_zone_(compilation_zone),
         safepoint_table_builder_(compilation_zone_) {}
 
@@ -267,6 +282,10 @@ class LiftoffCompiler {
   }
 
   void StartFunction(FullDecoder* decoder) {
+    if (supports_simd128_) {
+      // s128 values need wider stack slots.
+      __ set_stack_slot_size(LiftoffAssembler::kSimd128StackSlotSize);
+    }
     int num_locals = decoder->num_locals();
     __ set_num_locals(num_locals);
     for (int i = 0; i < num_locals; ++i) {
@@ -341,10 +360,29 @@ class LiftoffCompiler {
     __ bind(ool.continuation.get());
   }
 
+  Vector<const ValueType> supported_types() const {
+    return supports_simd128_ ? kSupportedTypesWithSimd : kSupportedTypes;
+  }
+
+  bool CheckSupportedSignature(FullDecoder* decoder, FunctionSig* sig) {
+    for (ValueType type : sig->parameters()) {
+      if (!CheckSupportedType(decoder, kSupportedTypes, type, "param")) {
+        return false;
+      }
+    }
+    for (ValueType type : sig->returns()) {
+      if (!CheckSupportedType(decoder, kSupportedTypes, type, "return")) {
+        return false;
+      }
+    }
+    return true;
+  }
+
   void StartFunctionBody(FullDecoder* decoder, Control* block) {
+    if (!CheckSupportedSignature(decoder, decoder->sig_)) return;
     for (uint32_t i = 0; i < __ num_locals(); ++i) {
-      if (!CheckSupportedType(decoder, kSupportedTypes, __ local_type(i),
-                              "param"))
+      if (!CheckSupportedType(decoder, supported_types(), __ local_type(i),
+                              "local"))
         return;
     }
 
@@ -395,11 +433,13 @@ class LiftoffCompiler {
           break;
         case kWasmF32:
         case kWasmF64:
+        case kWasmS128:
           if (zero_double_reg.is_gp()) {
             // Note: This might spill one of the registers used to hold
             // parameters.
             zero_double_reg = __ GetUnusedRegister(kFpReg);
-            // Zero is represented by the bit pattern 0 for both f32 and f64.
+            // Zero is represented by the bit pattern 0 for f32, f64 and s128.
+            // Loading the f64 zero clears the whole register.
             __ LoadConstant(zero_double_reg, WasmValue(0.));
           }
           __ PushRegister(type, zero_double_reg);
@@ -1669,7 +1709,7 @@ class LiftoffCompiler {
                const MemoryAccessImmediate<validate>& imm,
                const Value& index_val, Value* result) {
     ValueType value_type = type.value_type();
-    if (!CheckSupportedType(decoder, kSupportedTypes, value_type, "load"))
+    if (!CheckSupportedType(decoder, supported_types(), value_type, "load"))
       return;
     LiftoffRegList pinned;
     Register index = pinned.set(__ PopToRegister()).gp();
@@ -1702,7 +1742,7 @@ class LiftoffCompiler {
                 const MemoryAccessImmediate<validate>& imm,
                 const Value& index_val, const Value& value_val) {
     ValueType value_type = type.value_type();
-    if (!CheckSupportedType(decoder, kSupportedTypes, value_type, "store"))
+    if (!CheckSupportedType(decoder, supported_types(), value_type, "store"))
       return;
     LiftoffRegList pinned;
     LiftoffRegister value = pinned.set(__ PopToRegister());
@@ -1775,11 +1815,7 @@ class LiftoffCompiler {
     if (imm.sig->return_count() > 1) {
       return unsupported(decoder, kMultiValue, "multi-return");
     }
-    if (imm.sig->return_count() == 1 &&
-        !CheckSupportedType(decoder, kSupportedTypes, imm.sig->GetReturn(0),
-                            "return")) {
-      return;
-    }
+    if (!CheckSupportedSignature(decoder, imm.sig)) return;
 
     auto call_descriptor =
         compiler::GetWasmCallDescriptor(compilation_zone_, imm.sig);
@@ -1842,11 +1878,7 @@ class LiftoffCompiler {
     if (imm.table_index != 0) {
       return unsupported(decoder, kAnyRef, "table index != 0");
     }
-    if (imm.sig->return_count() == 1 &&
-        !CheckSupportedType(decoder, kSupportedTypes, imm.sig->GetReturn(0),
-                            "return")) {
-      return;
-    }
+    if (!CheckSupportedSignature(decoder, imm.sig)) return;
 
     // Pop the index.
     Register index = __ PopToRegister().gp();
@@ -1981,12 +2013,94 @@ class LiftoffCompiler {
   }
   void SimdOp(FullDecoder* decoder, WasmOpcode opcode, Vector<Value> args,
               Value* result) {
-    unsupported(decoder, kSimd, "simd");
+    if (!supports_simd128_) {
+      return unsupported(decoder, kSimd, "simd");
+    }
+#define CASE_SIMD_SPLAT(opcode, src_type, fn)           \
+  case WasmOpcode::kExpr##opcode:                       \
+    return EmitUnOp<kWasm##src_type, kWasmS128>(        \
+        [=](LiftoffRegister dst, LiftoffRegister src) { \
+          __ emit_##fn(dst, src);                       \
+        });
+#define CASE_SIMD_UNOP(opcode, fn)                      \
+  case WasmOpcode::kExpr##opcode:                       \
+    return EmitUnOp<kWasmS128, kWasmS128>(              \
+        [=](LiftoffRegister dst, LiftoffRegister src) { \
+          __ emit_##fn(dst, src);                       \
+        });
+#define CASE_SIMD_BINOP(opcode, fn)                                            \
+  case WasmOpcode::kExpr##opcode:                                              \
+    return EmitBinOp<kWasmS128, kWasmS128>(                                    \
+        [=](LiftoffRegister dst, LiftoffRegister lhs, LiftoffRegister rhs) {   \
+          __ emit_##fn(dst, lhs, rhs);                                         \
+        });
+    switch (opcode) {
+      CASE_SIMD_SPLAT(I32x4Splat, I32, i32x4_splat)
+      CASE_SIMD_SPLAT(F32x4Splat, F32, f32x4_splat)
+      CASE_SIMD_BINOP(I8x16Add, i8x16_add)
+      CASE_SIMD_BINOP(I8x16Sub, i8x16_sub)
+      CASE_SIMD_BINOP(I16x8Add, i16x8_add)
+      CASE_SIMD_BINOP(I16x8Sub, i16x8_sub)
+      CASE_SIMD_BINOP(I32x4Add, i32x4_add)
+      CASE_SIMD_BINOP(I32x4Sub, i32x4_sub)
+      CASE_SIMD_BINOP(I32x4Mul, i32x4_mul)
+      CASE_SIMD_BINOP(F32x4Add, f32x4_add)
+      CASE_SIMD_BINOP(F32x4Sub, f32x4_sub)
+      CASE_SIMD_BINOP(F32x4Mul, f32x4_mul)
+      CASE_SIMD_BINOP(S128And, s128_and)
+      CASE_SIMD_BINOP(S128Or, s128_or)
+      CASE_SIMD_BINOP(S128Xor, s128_xor)
+      CASE_SIMD_UNOP(S128Not, s128_not)
+      default:
+        return unsupported(decoder, kSimd, WasmOpcodes::OpcodeName(opcode));
+    }
+#undef CASE_SIMD_SPLAT
+#undef CASE_SIMD_UNOP
+#undef CASE_SIMD_BINOP
   }
   void SimdLaneOp(FullDecoder* decoder, WasmOpcode opcode,
                   const SimdLaneImmediate<validate>& imm,
                   const Vector<Value> inputs, Value* result) {
-    unsupported(decoder, kSimd, "simd");
+    if (!supports_simd128_) {
+      return unsupported(decoder, kSimd, "simd");
+    }
+    switch (opcode) {
+      case kExprI32x4ExtractLane:
+        return EmitSimdExtractLane<kWasmI32>(imm.lane);
+      case kExprF32x4ExtractLane:
+        return EmitSimdExtractLane<kWasmF32>(imm.lane);
+      case kExprI32x4ReplaceLane:
+        return EmitSimdReplaceLane<kWasmI32>(imm.lane);
+      case kExprF32x4ReplaceLane:
+        return EmitSimdReplaceLane<kWasmF32>(imm.lane);
+      default:
+        return unsupported(decoder, kSimd, WasmOpcodes::OpcodeName(opcode));
+    }
+  }
+  template <ValueType result_type>
+  void EmitSimdExtractLane(uint8_t lane) {
+    LiftoffRegister lhs = __ PopToRegister();
+    LiftoffRegister dst = __ GetUnusedRegister(reg_class_for(result_type),
+                                               LiftoffRegList::ForRegs(lhs));
+    if (result_type == kWasmI32) {
+      __ emit_i32x4_extract_lane(dst, lhs, lane);
+    } else {
+      __ emit_f32x4_extract_lane(dst, lhs, lane);
+    }
+    __ PushRegister(result_type, dst);
+  }
+  template <ValueType value_type>
+  void EmitSimdReplaceLane(uint8_t lane) {
+    LiftoffRegister value = __ PopToRegister();
+    LiftoffRegister vector = __ PopToRegister(LiftoffRegList::ForRegs(value));
+    LiftoffRegister dst = __ GetUnusedRegister(
+        kFpReg, LiftoffRegList::ForRegs(vector, value));
+    if (value_type == kWasmI32) {
+      __ emit_i32x4_replace_lane(dst, vector, value, lane);
+    } else {
+      __ emit_f32x4_replace_lane(dst, vector, value, lane);
+    }
+    __ PushRegister(kWasmS128, dst);
   }
   void SimdShiftOp(FullDecoder* decoder, WasmOpcode opcode,
                    const SimdShiftImmediate<validate>& imm, const Value& input,
@@ -2064,6 +2178,7 @@ class LiftoffCompiler {
   LiftoffAssembler asm_;
   compiler::CallDescriptor* const descriptor_;
   CompilationEnv* const env_;
+  const bool supports_simd128_;
   LiftoffBailoutReason bailout_reason_ = kSuccess;
   std::vector<OutOfLineCode> out_of_line_code_;
   SourcePositionTableBuilder source_position_table_builder_;
@@ -18,6 +18,14 @@ namespace wasm {
 
 static constexpr bool kNeedI64RegPair = kSystemPointerSize == 4;
 
+// Whether the platform can hold s128 values in fp registers. The fp cache
+// registers must then be full 128-bit vector registers.
+#if V8_TARGET_ARCH_X64 || V8_TARGET_ARCH_ARM64
+static constexpr bool kLiftoffSupportsSimd128 = true;
+#else
+static constexpr bool kLiftoffSupportsSimd128 = false;
+#endif
+
 enum RegClass : uint8_t {
   kGpReg,
   kFpReg,
@@ -40,7 +48,9 @@ static inline constexpr RegClass reg_class_for(ValueType type) {
                    ? kGpReg
                    : type == kWasmF32 || type == kWasmF64  // float types
                          ? kFpReg
-                         : kNoReg;  // other (unsupported) types
+                         : type == kWasmS128 && kLiftoffSupportsSimd128
+                               ? kFpReg  // simd type
+                               : kNoReg;  // other (unsupported) types
 }
 
 // Maximum code of a gp cache register.
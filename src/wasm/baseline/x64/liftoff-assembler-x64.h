@@ -37,14 +37,12 @@ static_assert(
     "scratch registers must not be used as cache registers");
 
 // rbp-8 holds the stack marker, rbp-16 is the instance parameter, first stack
-// slot is located at rbp-24.
+// slot is located at rbp-16-{stack_slot_size}.
 constexpr int32_t kConstantStackSpace = 16;
-constexpr int32_t kFirstStackSlotOffset =
-    kConstantStackSpace + LiftoffAssembler::kStackSlotSize;
 
-inline Operand GetStackSlot(uint32_t index) {
-  int32_t offset = index * LiftoffAssembler::kStackSlotSize;
-  return Operand(rbp, -kFirstStackSlotOffset - offset);
+inline Operand GetStackSlot(LiftoffAssembler* assm, uint32_t index) {
+  int32_t offset = (index + 1) * assm->stack_slot_size();
+  return Operand(rbp, -kConstantStackSpace - offset);
 }
 
 // TODO(clemensh): Make this a constexpr variable once Operand is constexpr.
@@ -80,6 +78,9 @@ inline void Load(LiftoffAssembler* assm, LiftoffRegister dst, Operand src,
     case kWasmF64:
       assm->Movsd(dst.fp(), src);
       break;
+    case kWasmS128:
+      assm->movdqu(dst.fp(), src);
+      break;
     default:
       UNREACHABLE();
   }
@@ -100,6 +101,9 @@ inline void Store(LiftoffAssembler* assm, Operand dst, LiftoffRegister src,
     case kWasmF64:
       assm->Movsd(dst, src.fp());
       break;
+    case kWasmS128:
+      assm->movdqu(dst, src.fp());
+      break;
     default:
       UNREACHABLE();
   }
@@ -144,6 +148,8 @@ int LiftoffAssembler::PrepareStackFrame() {
 
 void LiftoffAssembler::PatchPrepareStackFrame(int offset,
                                               uint32_t stack_slots) {
+  // {stack_slots} is given in units of {kStackSlotSize}, see
+  // {GetTotalFrameSlotCount}.
   uint32_t bytes = liftoff::kConstantStackSpace + kStackSlotSize * stack_slots;
   DCHECK_LE(bytes, kMaxInt);
   // We can't run out of space, just pass anything big enough to not cause the
@@ -294,6 +300,9 @@ void LiftoffAssembler::Load(LiftoffRegister dst, Register src_addr,
     case LoadType::kF64Load:
       Movsd(dst.fp(), src_op);
       break;
+    case LoadType::kS128Load:
+      movdqu(dst.fp(), src_op);
+      break;
     default:
       UNREACHABLE();
   }
@@ -330,6 +339,9 @@ void LiftoffAssembler::Store(Register dst_addr, Register offset_reg,
     case StoreType::kF64Store:
       Movsd(dst_op, src.fp());
       break;
+    case StoreType::kS128Store:
+      movdqu(dst_op, src.fp());
+      break;
     default:
       UNREACHABLE();
   }
@@ -345,15 +357,18 @@ void LiftoffAssembler::LoadCallerFrameSlot(LiftoffRegister dst,
 void LiftoffAssembler::MoveStackValue(uint32_t dst_index, uint32_t src_index,
                                       ValueType type) {
   DCHECK_NE(dst_index, src_index);
-  Operand src = liftoff::GetStackSlot(src_index);
-  Operand dst = liftoff::GetStackSlot(dst_index);
+  Operand src = liftoff::GetStackSlot(this, src_index);
+  Operand dst = liftoff::GetStackSlot(this, dst_index);
   if (ValueTypes::ElementSizeLog2Of(type) == 2) {
     movl(kScratchRegister, src);
     movl(dst, kScratchRegister);
-  } else {
-    DCHECK_EQ(3, ValueTypes::ElementSizeLog2Of(type));
+  } else if (ValueTypes::ElementSizeLog2Of(type) == 3) {
     movq(kScratchRegister, src);
     movq(dst, kScratchRegister);
+  } else {
+    DCHECK_EQ(kWasmS128, type);
+    movdqu(kScratchDoubleReg, src);
+    movdqu(dst, kScratchDoubleReg);
   }
 }
 
@@ -372,16 +387,18 @@ void LiftoffAssembler::Move(DoubleRegister dst, DoubleRegister src,
   DCHECK_NE(dst, src);
   if (type == kWasmF32) {
     Movss(dst, src);
-  } else {
-    DCHECK_EQ(kWasmF64, type);
+  } else if (type == kWasmF64) {
     Movsd(dst, src);
+  } else {
+    DCHECK_EQ(kWasmS128, type);
+    Movaps(dst, src);
   }
 }
 
 void LiftoffAssembler::Spill(uint32_t index, LiftoffRegister reg,
                              ValueType type) {
   RecordUsedSpillSlot(index);
-  Operand dst = liftoff::GetStackSlot(index);
+  Operand dst = liftoff::GetStackSlot(this, index);
   switch (type) {
     case kWasmI32:
       movl(dst, reg.gp());
@@ -395,6 +412,9 @@ void LiftoffAssembler::Spill(uint32_t index, LiftoffRegister reg,
     case kWasmF64:
       Movsd(dst, reg.fp());
       break;
+    case kWasmS128:
+      movdqu(dst, reg.fp());
+      break;
     default:
       UNREACHABLE();
   }
@@ -402,7 +422,7 @@ void LiftoffAssembler::Spill(uint32_t index, LiftoffRegister reg,
 
 void LiftoffAssembler::Spill(uint32_t index, WasmValue value) {
   RecordUsedSpillSlot(index);
-  Operand dst = liftoff::GetStackSlot(index);
+  Operand dst = liftoff::GetStackSlot(this, index);
   switch (value.type()) {
     case kWasmI32:
       movl(dst, Immediate(value.to_i32()));
@@ -429,7 +449,7 @@ void LiftoffAssembler::Spill(uint32_t index, WasmValue value) {
 
 void LiftoffAssembler::Fill(LiftoffRegister reg, uint32_t index,
                             ValueType type) {
-  Operand src = liftoff::GetStackSlot(index);
+  Operand src = liftoff::GetStackSlot(this, index);
   switch (type) {
     case kWasmI32:
       movl(reg.gp(), src);
@@ -443,6 +463,9 @@ void LiftoffAssembler::Fill(LiftoffRegister reg, uint32_t index,
     case kWasmF64:
       Movsd(reg.fp(), src);
       break;
+    case kWasmS128:
+      movdqu(reg.fp(), src);
+      break;
     default:
       UNREACHABLE();
   }
@@ -1403,6 +1426,153 @@ void LiftoffAssembler::emit_i64_signextend_i32(LiftoffRegister dst,
   movsxlq(dst.gp(), src.gp());
 }
 
+namespace liftoff {
+// Emits {dst = lhs op rhs} for the two-operand SSE instruction {op}.
+template <void (Assembler::*op)(XMMRegister, XMMRegister)>
+void EmitSimdBinOp(LiftoffAssembler* assm, LiftoffRegister dst,
+                   LiftoffRegister lhs, LiftoffRegister rhs,
+                   bool is_commutative) {
+  XMMRegister rhs_reg = rhs.fp();
+  if (dst == rhs) {
+    if (is_commutative) {
+      (assm->*op)(dst.fp(), lhs.fp());
+      return;
+    }
+    assm->movaps(kScratchDoubleReg, rhs.fp());
+    rhs_reg = kScratchDoubleReg;
+  }
+  if (dst != lhs) assm->movaps(dst.fp(), lhs.fp());
+  (assm->*op)(dst.fp(), rhs_reg);
+}
+}  // namespace liftoff
+
+void LiftoffAssembler::emit_i32x4_splat(LiftoffRegister dst,
+                                        LiftoffRegister src) {
+  movd(dst.fp(), src.gp());
+  pshufd(dst.fp(), dst.fp(), 0);
+}
+
+void LiftoffAssembler::emit_f32x4_splat(LiftoffRegister dst,
+                                        LiftoffRegister src) {
+  if (dst != src) movaps(dst.fp(), src.fp());
+  shufps(dst.fp(), dst.fp(), 0);
+}
+
+void LiftoffAssembler::emit_i32x4_extract_lane(LiftoffRegister dst,
+                                               LiftoffRegister lhs,
+                                               uint8_t imm_lane_idx) {
+  DCHECK(CpuFeatures::IsSupported(SSE4_1));
+  CpuFeatureScope scope(this, SSE4_1);
+  pextrd(dst.gp(), lhs.fp(), imm_lane_idx);
+}
+
+void LiftoffAssembler::emit_f32x4_extract_lane(LiftoffRegister dst,
+                                               LiftoffRegister lhs,
+                                               uint8_t imm_lane_idx) {
+  // Move the lane into the low 32 bits; the upper lanes of an f32 register
+  // are never read.
+  pshufd(dst.fp(), lhs.fp(), imm_lane_idx);
+}
+
+void LiftoffAssembler::emit_i32x4_replace_lane(LiftoffRegister dst,
+                                               LiftoffRegister src1,
+                                               LiftoffRegister src2,
+                                               uint8_t imm_lane_idx) {
+  DCHECK(CpuFeatures::IsSupported(SSE4_1));
+  CpuFeatureScope scope(this, SSE4_1);
+  if (dst != src1) movaps(dst.fp(), src1.fp());
+  pinsrd(dst.fp(), src2.gp(), imm_lane_idx);
+}
+
+void LiftoffAssembler::emit_f32x4_replace_lane(LiftoffRegister dst,
+                                               LiftoffRegister src1,
+                                               LiftoffRegister src2,
+                                               uint8_t imm_lane_idx) {
+  DCHECK(CpuFeatures::IsSupported(SSE4_1));
+  CpuFeatureScope scope(this, SSE4_1);
+  XMMRegister value = src2.fp();
+  if (dst == src2 && dst != src1) {
+    movaps(kScratchDoubleReg, src2.fp());
+    value = kScratchDoubleReg;
+  }
+  if (dst != src1) movaps(dst.fp(), src1.fp());
+  insertps(dst.fp(), value, imm_lane_idx << 4);
+}
+
+void LiftoffAssembler::emit_i8x16_add(LiftoffRegister dst, LiftoffRegister lhs,
+                                      LiftoffRegister rhs) {
+  liftoff::EmitSimdBinOp<&Assembler::paddb>(this, dst, lhs, rhs, true);
+}
+
+void LiftoffAssembler::emit_i8x16_sub(LiftoffRegister dst, LiftoffRegister lhs,
+                                      LiftoffRegister rhs) {
+  liftoff::EmitSimdBinOp<&Assembler::psubb>(this, dst, lhs, rhs, false);
+}
+
+void LiftoffAssembler::emit_i16x8_add(LiftoffRegister dst, LiftoffRegister lhs,
+                                      LiftoffRegister rhs) {
+  liftoff::EmitSimdBinOp<&Assembler::paddw>(this, dst, lhs, rhs, true);
+}
+
+void LiftoffAssembler::emit_i16x8_sub(LiftoffRegister dst, LiftoffRegister lhs,
+                                      LiftoffRegister rhs) {
+  liftoff::EmitSimdBinOp<&Assembler::psubw>(this, dst, lhs, rhs, false);
+}
+
+void LiftoffAssembler::emit_i32x4_add(LiftoffRegister dst, LiftoffRegister lhs,
+                                      LiftoffRegister rhs) {
+  liftoff::EmitSimdBinOp<&Assembler::paddd>(this, dst, lhs, rhs, true);
+}
+
+void LiftoffAssembler::emit_i32x4_sub(LiftoffRegister dst, LiftoffRegister lhs,
+                                      LiftoffRegister rhs) {
+  liftoff::EmitSimdBinOp<&Assembler::psubd>(this, dst, lhs, rhs, false);
+}
+
+void LiftoffAssembler::emit_i32x4_mul(LiftoffRegister dst, LiftoffRegister lhs,
+                                      LiftoffRegister rhs) {
+  DCHECK(CpuFeatures::IsSupported(SSE4_1));
+  CpuFeatureScope scope(this, SSE4_1);
+  liftoff::EmitSimdBinOp<&Assembler::pmulld>(this, dst, lhs, rhs, true);
+}
+
+void LiftoffAssembler::emit_f32x4_add(LiftoffRegister dst, LiftoffRegister lhs,
+                                      LiftoffRegister rhs) {
+  liftoff::EmitSimdBinOp<&Assembler::addps>(this, dst, lhs, rhs, true);
+}
+
+void LiftoffAssembler::emit_f32x4_sub(LiftoffRegister dst, LiftoffRegister lhs,
+                                      LiftoffRegister rhs) {
+  liftoff::EmitSimdBinOp<&Assembler::subps>(this, dst, lhs, rhs, false);
+}
+
+void LiftoffAssembler::emit_f32x4_mul(LiftoffRegister dst, LiftoffRegister lhs,
+                                      LiftoffRegister rhs) {
+  liftoff::EmitSimdBinOp<&Assembler::mulps>(this, dst, lhs, rhs, true);
+}
+
+void LiftoffAssembler::emit_s128_and(LiftoffRegister dst, LiftoffRegister lhs,
+                                     LiftoffRegister rhs) {
+  liftoff::EmitSimdBinOp<&Assembler::pand>(this, dst, lhs, rhs, true);
+}
+
+void LiftoffAssembler::emit_s128_or(LiftoffRegister dst, LiftoffRegister lhs,
+                                    LiftoffRegister rhs) {
+  liftoff::EmitSimdBinOp<&Assembler::por>(this, dst, lhs, rhs, true);
+}
+
+void LiftoffAssembler::emit_s128_xor(LiftoffRegister dst, LiftoffRegister lhs,
+                                     LiftoffRegister rhs) {
+  liftoff::EmitSimdBinOp<&Assembler::pxor>(this, dst, lhs, rhs, true);
+}
+
+void LiftoffAssembler::emit_s128_not(LiftoffRegister dst,
+                                     LiftoffRegister src) {
+  pcmpeqd(kScratchDoubleReg, kScratchDoubleReg);
+  if (dst != src) movaps(dst.fp(), src.fp());
+  pxor(dst.fp(), kScratchDoubleReg);
+}
+
 void LiftoffAssembler::emit_jump(Label* label) { jmp(label); }
 
 void LiftoffAssembler::emit_jump(Register target) { jmp(target); }
@@ -1519,26 +1689,37 @@ void LiftoffAssembler::PushRegisters(LiftoffRegList regs) {
   LiftoffRegList fp_regs = regs & kFpCacheRegList;
   unsigned num_fp_regs = fp_regs.GetNumRegsSet();
   if (num_fp_regs) {
-    AllocateStackSpace(num_fp_regs * kStackSlotSize);
+    // Preserve the full 128 bits if the registers can hold s128 values.
+    unsigned fp_reg_size = stack_slot_size();
+    AllocateStackSpace(num_fp_regs * fp_reg_size);
     unsigned offset = 0;
     while (!fp_regs.is_empty()) {
       LiftoffRegister reg = fp_regs.GetFirstRegSet();
-      Movsd(Operand(rsp, offset), reg.fp());
+      if (fp_reg_size == kSimd128StackSlotSize) {
+        movdqu(Operand(rsp, offset), reg.fp());
+      } else {
+        Movsd(Operand(rsp, offset), reg.fp());
+      }
       fp_regs.clear(reg);
-      offset += sizeof(double);
+      offset += fp_reg_size;
     }
-    DCHECK_EQ(offset, num_fp_regs * sizeof(double));
+    DCHECK_EQ(offset, num_fp_regs * fp_reg_size);
   }
 }
 
 void LiftoffAssembler::PopRegisters(LiftoffRegList regs) {
   LiftoffRegList fp_regs = regs & kFpCacheRegList;
+  unsigned fp_reg_size = stack_slot_size();
   unsigned fp_offset = 0;
   while (!fp_regs.is_empty()) {
     LiftoffRegister reg = fp_regs.GetFirstRegSet();
-    Movsd(reg.fp(), Operand(rsp, fp_offset));
+    if (fp_reg_size == kSimd128StackSlotSize) {
+      movdqu(reg.fp(), Operand(rsp, fp_offset));
+    } else {
+      Movsd(reg.fp(), Operand(rsp, fp_offset));
+    }
     fp_regs.clear(reg);
-    fp_offset += sizeof(double);
+    fp_offset += fp_reg_size;
   }
   if (fp_offset) addq(rsp, Immediate(fp_offset));
   LiftoffRegList gp_regs = regs & kGpCacheRegList;
@@ -1638,14 +1819,15 @@ void LiftoffStackSlots::Construct() {
         if (src.type() == kWasmI32) {
           // Load i32 values to a register first to ensure they are zero
           // extended.
-          asm_->movl(kScratchRegister, liftoff::GetStackSlot(slot.src_index_));
+          asm_->movl(kScratchRegister,
+                     liftoff::GetStackSlot(asm_, slot.src_index_));
           asm_->pushq(kScratchRegister);
         } else {
           // For all other types, just push the whole (8-byte) stack slot.
           // This is also ok for f32 values (even though we copy 4 uninitialized
           // bytes), because f32 and f64 values are clearly distinguished in
           // Turbofan, so the uninitialized bytes are never accessed.
-          asm_->pushq(liftoff::GetStackSlot(slot.src_index_));
+          asm_->pushq(liftoff::GetStackSlot(asm_, slot.src_index_));
         }
         break;
       case LiftoffAssembler::VarState::kRegister:
@@ -1868,8 +1868,23 @@ i::Address FuncData::v8_callback(void* data, i::Address argv) {
   int num_param_types = static_cast<int>(param_types.size());
   int num_result_types = static_cast<int>(result_types.size());
 
-  std::unique_ptr<Val[]> params(new Val[num_param_types]);
-  std::unique_ptr<Val[]> results(new Val[num_result_types]);
+  // Most host functions take and return only a handful of values; avoid
+  // heap-allocating the argument and result vectors on every call for those.
+  static constexpr int kMaxInlineValues = 8;
+  Val inline_params[kMaxInlineValues];
+  Val inline_results[kMaxInlineValues];
+  std::unique_ptr<Val[]> heap_params;
+  std::unique_ptr<Val[]> heap_results;
+  Val* params = inline_params;
+  Val* results = inline_results;
+  if (num_param_types > kMaxInlineValues) {
+    heap_params.reset(new Val[num_param_types]);
+    params = heap_params.get();
+  }
+  if (num_result_types > kMaxInlineValues) {
+    heap_results.reset(new Val[num_result_types]);
+    results = heap_results.get();
+  }
   i::Address p = argv;
   for (int i = 0; i < num_param_types; ++i) {
     switch (param_types[i]->kind()) {
@@ -1907,9 +1922,9 @@ i::Address FuncData::v8_callback(void* data, i::Address argv) {
 
   own<Trap*> trap;
   if (self->kind == kCallbackWithEnv) {
-    trap = self->callback_with_env(self->env, params.get(), results.get());
+    trap = self->callback_with_env(self->env, params, results);
   } else {
-    trap = self->callback(params.get(), results.get());
+    trap = self->callback(params, results);
   }
 
   if (trap) {
@@ -836,9 +836,24 @@ bool CompileLazy(Isolate* isolate, NativeModule* native_module,
   Counters* counters = isolate->counters();
 
   DCHECK(!native_module->lazy_compile_frozen());
+
+  // Aged code is routed through the lazy compile stub to observe its next
+  // call (see {--wasm-code-aging}).
+  if (native_module->ReactivateAgedCode(func_index)) {
+    TRACE_LAZY("Reactivated wasm-function#%d.\n", func_index);
+    return true;
+  }
+
   HistogramTimerScope lazy_time_scope(counters->wasm_lazy_compilation_time());
   NativeModuleModificationScope native_module_modification_scope(native_module);
 
+  // Modules deserialized with {--wasm-lazy-deserialization} install the
+  // serialized code of a function instead of compiling it.
+  if (DeserializeFunctionLazily(isolate, native_module, func_index)) {
+    TRACE_LAZY("Deserialized wasm-function#%d.\n", func_index);
+    return true;
+  }
+
   base::ElapsedTimer compilation_timer;
   compilation_timer.Start();
 
@@ -1318,8 +1333,34 @@ AsyncCompileJob::AsyncCompileJob(
   native_context_ =
       isolate->global_handles()->Create(context->native_context());
   DCHECK(native_context_->IsNativeContext());
+  if (FLAG_wasm_native_module_cache) {
+    cache_waiter_ = base::make_unique<NativeModuleCacheWaiter>(this);
+  }
 }
 
+// Continues an {AsyncCompileJob} which joined an in-flight compilation of the
+// same wire bytes, once that compilation finished.
+class AsyncCompileJob::NativeModuleCacheWaiter
+    : public NativeModuleCache::Waiter {
+ public:
+  explicit NativeModuleCacheWaiter(AsyncCompileJob* job) : job_(job) {}
+
+  void OnNativeModuleReady(
+      std::shared_ptr<NativeModule> native_module) override {
+    if (native_module) {
+      job_->DoSync<UseCachedNativeModule>(std::move(native_module));
+    } else {
+      // The other compilation failed or was aborted. Start over; this job
+      // either becomes the owner of the cache entry, or joins another
+      // compilation again.
+      job_->DoAsync<DecodeModule>(job_->isolate_->counters());
+    }
+  }
+
+ private:
+  AsyncCompileJob* const job_;
+};
+
 void AsyncCompileJob::Start() {
   DoAsync<DecodeModule>(isolate_->counters());  // --
 }
@@ -1367,6 +1408,14 @@ class AsyncStreamingProcessor final : public StreamingProcessor {
   AsyncCompileJob* job_;
   std::unique_ptr<CompilationUnitBuilder> compilation_unit_builder_;
   int num_functions_ = 0;
+  // Hash of everything before the code section, used to detect modules which
+  // are likely in the {NativeModuleCache}.
+  NativeModuleCache::PrefixHashBuilder prefix_hash_builder_;
+  bool code_section_started_ = false;
+  // If set, a cached module matched the prefix of this module. The rest of the
+  // stream is then only buffered, and the module is decoded (or fetched from
+  // the cache) once all bytes were received.
+  bool prefix_cache_hit_ = false;
 };
 
 std::shared_ptr<StreamingDecoder> AsyncCompileJob::CreateStreamingDecoder() {
@@ -1378,7 +1427,16 @@ std::shared_ptr<StreamingDecoder> AsyncCompileJob::CreateStreamingDecoder() {
 
 AsyncCompileJob::~AsyncCompileJob() {
   // Note: This destructor always runs on the foreground thread of the isolate.
+  // Stop waiting for other compilations first, such that no new tasks get
+  // scheduled for this job.
+  if (cache_waiter_) {
+    isolate_->wasm_engine()->native_module_cache()->RemoveWaiter(
+        cache_waiter_.get());
+  }
   background_task_manager_.CancelAndWait();
+  // Release the cache entry if compilation did not finish, such that other
+  // compilations of the same bytes do not wait for this one forever.
+  if (owns_cache_entry_) UpdateNativeModuleCache(true);
   // If the runtime objects were not created yet, then initial compilation did
   // not finish yet. In this case we can abort compilation.
   if (native_module_ && module_object_.is_null()) {
@@ -1444,6 +1502,11 @@ void AsyncCompileJob::PrepareRuntimeObjects() {
 void AsyncCompileJob::FinishCompile() {
   bool is_after_deserialization = !module_object_.is_null();
   if (!is_after_deserialization) {
+    if (UpdateNativeModuleCache(false)) {
+      // {job} is deleted in FinishWithCachedNativeModule, therefore the
+      // {return}.
+      return FinishWithCachedNativeModule(native_module_);
+    }
     PrepareRuntimeObjects();
   }
   DCHECK(!isolate_->context().is_null());
@@ -1473,7 +1536,42 @@ void AsyncCompileJob::FinishCompile() {
   FinishModule();
 }
 
+bool AsyncCompileJob::UpdateNativeModuleCache(bool failed) {
+  if (!FLAG_wasm_native_module_cache) return false;
+  NativeModuleCache* cache = isolate_->wasm_engine()->native_module_cache();
+  if (failed) {
+    if (owns_cache_entry_) {
+      cache->Update(wire_bytes_.module_bytes(), enabled_features_, nullptr,
+                    true);
+    }
+    owns_cache_entry_ = false;
+    return false;
+  }
+  std::shared_ptr<NativeModule> native_module =
+      cache->Update(wire_bytes_.module_bytes(), enabled_features_,
+                    native_module_, owns_cache_entry_);
+  owns_cache_entry_ = false;
+  if (native_module == native_module_) return false;
+  // Another compilation of the same bytes finished first. Drop our module.
+  native_module_ = std::move(native_module);
+  wire_bytes_ = ModuleWireBytes(native_module_->wire_bytes());
+  return true;
+}
+
+void AsyncCompileJob::FinishWithCachedNativeModule(
+    std::shared_ptr<NativeModule> native_module) {
+  native_module_ = std::move(native_module);
+  wire_bytes_ = ModuleWireBytes(native_module_->wire_bytes());
+  // Registers the module with this isolate, creates the module object and
+  // compiles the JS-to-wasm wrappers.
+  Handle<WasmModuleObject> module_object =
+      isolate_->wasm_engine()->ImportNativeModule(isolate_, native_module_);
+  module_object_ = isolate_->global_handles()->Create(*module_object);
+  FinishModule();
+}
+
 void AsyncCompileJob::DecodeFailed(const WasmError& error) {
+  UpdateNativeModuleCache(true);
   ErrorThrower thrower(isolate_, api_method_name_);
   thrower.CompileFailed(error);
   // {job} keeps the {this} pointer alive.
@@ -1490,6 +1588,7 @@ void AsyncCompileJob::AsyncCompileFailed() {
                        isolate_->counters(), isolate_->allocator(), &thrower,
                        lazy_module);
   DCHECK(thrower.error());
+  UpdateNativeModuleCache(true);
   // {job} keeps the {this} pointer alive.
   std::shared_ptr<AsyncCompileJob> job =
       isolate_->wasm_engine()->RemoveCompileJob(this);
@@ -1671,6 +1770,28 @@ class AsyncCompileJob::DecodeModule : public AsyncCompileJob::CompileStep {
   explicit DecodeModule(Counters* counters) : counters_(counters) {}
 
   void RunInBackground(AsyncCompileJob* job) override {
+    if (job->cache_waiter_ && !job->owns_cache_entry_) {
+      std::shared_ptr<NativeModule> cached_native_module;
+      NativeModuleCache::LookupResult cache_result =
+          job->isolate()->wasm_engine()->native_module_cache()->Lookup(
+              job->wire_bytes_.module_bytes(), job->enabled_features_,
+              NativeModuleCache::kAsyncCompile, job->cache_waiter_.get(),
+              &cached_native_module);
+      switch (cache_result) {
+        case NativeModuleCache::kHit:
+          job->DoSync<UseCachedNativeModule>(std::move(cached_native_module));
+          return;
+        case NativeModuleCache::kJoined:
+          // The {cache_waiter_} continues the job. It might already have
+          // replaced this step, so do not access any fields any more.
+          return;
+        case NativeModuleCache::kOwner:
+          job->owns_cache_entry_ = true;
+          break;
+        case NativeModuleCache::kBusy:
+          UNREACHABLE();
+      }
+    }
     ModuleResult result;
     {
       DisallowHandleAllocation no_handle;
@@ -1748,6 +1869,25 @@ class AsyncCompileJob::DecodeFail : public CompileStep {
   }
 };
 
+//==========================================================================
+// Step 1c (sync): Use a module compiled from the same wire bytes.
+//==========================================================================
+class AsyncCompileJob::UseCachedNativeModule : public CompileStep {
+ public:
+  explicit UseCachedNativeModule(std::shared_ptr<NativeModule> native_module)
+      : native_module_(std::move(native_module)) {}
+
+ private:
+  std::shared_ptr<NativeModule> native_module_;
+
+  void RunInForeground(AsyncCompileJob* job) override {
+    TRACE_COMPILE("(1c) Using cached native module...\n");
+    // {job_} is deleted in FinishWithCachedNativeModule, therefore the
+    // {return}.
+    return job->FinishWithCachedNativeModule(std::move(native_module_));
+  }
+};
+
 //==========================================================================
 // Step 2 (sync): Create heap-allocated data and start compile.
 //==========================================================================
@@ -1867,7 +2007,8 @@ void AsyncCompileJob::FinishModule() {
 AsyncStreamingProcessor::AsyncStreamingProcessor(AsyncCompileJob* job)
     : decoder_(job->enabled_features_),
       job_(job),
-      compilation_unit_builder_(nullptr) {}
+      compilation_unit_builder_(nullptr),
+      prefix_hash_builder_(job->enabled_features_) {}
 
 void AsyncStreamingProcessor::FinishAsyncCompileJobWithError(
     const WasmError& error) {
@@ -1904,6 +2045,7 @@ bool AsyncStreamingProcessor::ProcessModuleHeader(Vector<const uint8_t> bytes,
     FinishAsyncCompileJobWithError(decoder_.FinishDecoding(false).error());
     return false;
   }
+  prefix_hash_builder_.AddModuleHeader(bytes);
   return true;
 }
 
@@ -1912,6 +2054,10 @@ bool AsyncStreamingProcessor::ProcessSection(SectionCode section_code,
                                              Vector<const uint8_t> bytes,
                                              uint32_t offset) {
   TRACE_STREAMING("Process section %d ...\n", section_code);
+  if (prefix_cache_hit_) return true;
+  if (!code_section_started_) {
+    prefix_hash_builder_.AddSection(section_code, bytes);
+  }
   if (compilation_unit_builder_) {
     // We reached a section after the code section, we do not need the
     // compilation_unit_builder_ anymore.
@@ -1950,6 +2096,15 @@ bool AsyncStreamingProcessor::ProcessCodeSectionHeader(
     FinishAsyncCompileJobWithError(decoder_.FinishDecoding(false).error());
     return false;
   }
+  code_section_started_ = true;
+  if (FLAG_wasm_native_module_cache &&
+      job_->isolate()->wasm_engine()->native_module_cache()->HasPrefix(
+          prefix_hash_builder_.hash())) {
+    // Do not start compilation; the module is probably cached already.
+    TRACE_STREAMING("Module prefix found in the native module cache\n");
+    prefix_cache_hit_ = true;
+    return true;
+  }
   // Execute the PrepareAndStartCompile step immediately and not in a separate
   // task.
   job_->DoImmediately<AsyncCompileJob::PrepareAndStartCompile>(
@@ -1978,6 +2133,7 @@ bool AsyncStreamingProcessor::ProcessCodeSectionHeader(
 bool AsyncStreamingProcessor::ProcessFunctionBody(Vector<const uint8_t> bytes,
                                                   uint32_t offset) {
   TRACE_STREAMING("Process function body %d ...\n", num_functions_);
+  if (prefix_cache_hit_) return true;
 
   decoder_.DecodeFunctionBody(
       num_functions_, static_cast<uint32_t>(bytes.length()), offset, false);
@@ -2039,6 +2195,17 @@ void AsyncStreamingProcessor::OnFinishedChunk() {
 // Finish the processing of the stream.
 void AsyncStreamingProcessor::OnFinishedStream(OwnedVector<uint8_t> bytes) {
   TRACE_STREAMING("Finish stream...\n");
+  if (prefix_cache_hit_) {
+    // Continue like an asynchronous compilation of the received bytes. This
+    // looks up the full bytes in the cache, and only decodes and compiles the
+    // module if it was not found.
+    size_t length = bytes.size();
+    job_->bytes_copy_ = bytes.ReleaseData();
+    job_->wire_bytes_ = ModuleWireBytes(job_->bytes_copy_.get(),
+                                        job_->bytes_copy_.get() + length);
+    job_->DoAsync<AsyncCompileJob::DecodeModule>(job_->isolate()->counters());
+    return;
+  }
   ModuleResult result = decoder_.FinishDecoding(false);
   if (result.failed()) {
     FinishAsyncCompileJobWithError(result.error());
@@ -2446,6 +2613,11 @@ class CompileJSToWasmWrapperTask final : public CancelableTask {
 
 void CompileJsToWasmWrappers(Isolate* isolate, const WasmModule* module,
                              Handle<FixedArray> export_wrappers) {
+  // With lazy wrappers, exported functions start out with a builtin that
+  // compiles the wrapper for their signature on their first call.
+  if (FLAG_wasm_lazy_js_to_wasm_wrappers && module->origin == kWasmOrigin) {
+    return;
+  }
   JSToWasmWrapperQueue queue;
   JSToWasmWrapperUnitMap compilation_units;
 
@@ -2502,18 +2674,24 @@ WasmCode* CompileImportWrapper(
   // yet.
   WasmImportWrapperCache::CacheKey key(kind, sig);
   DCHECK_NULL((*cache_scope)[key]);
-  bool source_positions = native_module->module()->origin == kAsmJsOrigin;
   // Keep the {WasmCode} alive until we explicitly call {IncRef}.
   WasmCodeRefScope code_ref_scope;
-  CompilationEnv env = native_module->CreateCompilationEnv();
-  WasmCompilationResult result = compiler::CompileWasmImportCallWrapper(
-      wasm_engine, &env, kind, sig, source_positions);
-  std::unique_ptr<WasmCode> wasm_code = native_module->AddCode(
-      result.func_index, result.code_desc, result.frame_slot_count,
-      result.tagged_parameter_slots, std::move(result.protected_instructions),
-      std::move(result.source_positions), GetCodeKind(result),
-      ExecutionTier::kNone);
-  WasmCode* published_code = native_module->PublishCode(std::move(wasm_code));
+  WasmCode* published_code;
+  if (kind == compiler::WasmImportCallKind::kWasmToCapi) {
+    published_code =
+        compiler::CompileWasmCapiCallWrapper(wasm_engine, native_module, sig);
+  } else {
+    bool source_positions = native_module->module()->origin == kAsmJsOrigin;
+    CompilationEnv env = native_module->CreateCompilationEnv();
+    WasmCompilationResult result = compiler::CompileWasmImportCallWrapper(
+        wasm_engine, &env, kind, sig, source_positions);
+    std::unique_ptr<WasmCode> wasm_code = native_module->AddCode(
+        result.func_index, result.code_desc, result.frame_slot_count,
+        result.tagged_parameter_slots, std::move(result.protected_instructions),
+        std::move(result.source_positions), GetCodeKind(result),
+        ExecutionTier::kNone);
+    published_code = native_module->PublishCode(std::move(wasm_code));
+  }
   (*cache_scope)[key] = published_code;
   published_code->IncRef();
   counters->wasm_generated_code_size()->Increment(
@@ -123,10 +123,12 @@ class AsyncCompileJob {
   class CompileTask;
   class CompileStep;
   class CompilationStateCallback;
+  class NativeModuleCacheWaiter;
 
   // States of the AsyncCompileJob.
   class DecodeModule;            // Step 1  (async)
   class DecodeFail;              // Step 1b (sync)
+  class UseCachedNativeModule;   // Step 1c (sync)
   class PrepareAndStartCompile;  // Step 2  (sync)
   class CompileFailed;           // Step 3a (sync)
   class CompileFinished;         // Step 3b (sync)
@@ -146,6 +148,12 @@ class AsyncCompileJob {
 
   void FinishCompile();
 
+  // Publishes the result of this compilation in the engine's
+  // {NativeModuleCache}. Returns true if a module from the cache replaced
+  // {native_module_}.
+  bool UpdateNativeModuleCache(bool failed);
+  void FinishWithCachedNativeModule(std::shared_ptr<NativeModule>);
+
   void DecodeFailed(const WasmError&);
   void AsyncCompileFailed();
 
@@ -216,6 +224,14 @@ class AsyncCompileJob {
   // A reference to a pending foreground task, or {nullptr} if none is pending.
   CompileTask* pending_foreground_task_ = nullptr;
 
+  // Set if this job owns the in-flight entry for its wire bytes in the
+  // {NativeModuleCache} and thus has to resolve it.
+  bool owns_cache_entry_ = false;
+
+  // Notified if this job joined a compilation of the same wire bytes which
+  // is in flight. Only allocated if --wasm-native-module-cache is enabled.
+  std::unique_ptr<NativeModuleCacheWaiter> cache_waiter_;
+
   // The AsyncCompileJob owns the StreamingDecoder because the StreamingDecoder
   // contains data which is needed by the AsyncCompileJob for streaming
   // compilation. The AsyncCompileJob does not actively use the
@@ -860,15 +860,13 @@ bool InstanceBuilder::ProcessImportedFunction(
       break;
     }
     case compiler::WasmImportCallKind::kWasmToCapi: {
+      // The wrapper only depends on the signature and was compiled (or found
+      // in the cache) by {CompileImportWrappers}.
       NativeModule* native_module = instance->module_object().native_module();
-      Address host_address = WasmCapiFunction::cast(*value).GetHostCallTarget();
-      WasmCodeRefScope code_ref_scope;
-      WasmCode* wasm_code = compiler::CompileWasmCapiCallWrapper(
-          isolate_->wasm_engine(), native_module, expected_sig, host_address);
-      isolate_->counters()->wasm_generated_code_size()->Increment(
-          wasm_code->instructions().length());
-      isolate_->counters()->wasm_reloc_size()->Increment(
-          wasm_code->reloc_info().length());
+      WasmCode* wasm_code =
+          native_module->import_wrapper_cache()->Get(kind, expected_sig);
+      DCHECK_NOT_NULL(wasm_code);
+      DCHECK_EQ(WasmCode::kWasmToCapiWrapper, wasm_code->kind());
 
       ImportedFunctionEntry entry(instance, func_index);
       // We re-use the SetWasmToJs infrastructure because it passes the
@@ -1219,8 +1217,7 @@ void InstanceBuilder::CompileImportWrappers(
     auto kind =
         compiler::GetWasmImportCallKind(js_receiver, sig, enabled_.bigint);
     if (kind == compiler::WasmImportCallKind::kWasmToWasm ||
-        kind == compiler::WasmImportCallKind::kLinkError ||
-        kind == compiler::WasmImportCallKind::kWasmToCapi) {
+        kind == compiler::WasmImportCallKind::kLinkError) {
       continue;
     }
     WasmImportWrapperCache::CacheKey key(kind, sig);
@@ -702,6 +702,53 @@ void NativeModule::UseLazyStub(uint32_t func_index) {
       runtime_stub_entry(WasmCode::kWasmCompileLazy), WasmCode::kFlushICache);
 }
 
+std::vector<WasmCode*> NativeModule::AgeCode(int max_age) {
+  DCHECK_LT(0, max_age);
+  DCHECK_GE(kMaxUInt8, max_age);
+  std::vector<WasmCode*> evicted_code;
+  // Evicted functions are recompiled lazily, which is not possible if lazy
+  // compilation was frozen.
+  if (lazy_compile_frozen()) return evicted_code;
+
+  NativeModuleModificationScope native_module_modification_scope(this);
+  base::MutexGuard lock(&allocation_mutex_);
+  uint32_t num_declared_functions = module_->num_declared_functions;
+  if (!code_ages_) code_ages_.reset(new uint8_t[num_declared_functions]());
+  for (uint32_t slot_idx = 0; slot_idx < num_declared_functions; ++slot_idx) {
+    WasmCode* code = code_table_[slot_idx];
+    if (code == nullptr || code->kind() != WasmCode::kFunction ||
+        code->tier() != ExecutionTier::kTurbofan) {
+      continue;
+    }
+    uint32_t func_index = slot_idx + module_->num_imported_functions;
+    if (has_interpreter_redirection(func_index)) continue;
+    // Route the next call through the lazy compile stub to observe it.
+    if (code_ages_[slot_idx]++ == 0) UseLazyStub(func_index);
+    if (code_ages_[slot_idx] < max_age) continue;
+    code_ages_[slot_idx] = 0;
+    code_table_[slot_idx] = nullptr;
+    evicted_code.push_back(code);
+  }
+  return evicted_code;
+}
+
+bool NativeModule::ReactivateAgedCode(uint32_t func_index) {
+  NativeModuleModificationScope native_module_modification_scope(this);
+  base::MutexGuard lock(&allocation_mutex_);
+  if (!code_ages_) return false;
+  DCHECK_LE(module_->num_imported_functions, func_index);
+  uint32_t slot_idx = func_index - module_->num_imported_functions;
+  WasmCode* code = code_table_[slot_idx];
+  if (code == nullptr) return false;
+  code_ages_[slot_idx] = 0;
+  if (!has_interpreter_redirection(func_index)) {
+    JumpTableAssembler::PatchJumpTableSlot(
+        jump_table_->instruction_start(), slot_idx, code->instruction_start(),
+        WasmCode::kFlushICache);
+  }
+  return true;
+}
+
 // TODO(mstarzinger): Remove {Isolate} parameter once {V8_EMBEDDED_BUILTINS}
 // was removed and embedded builtins are no longer optional.
 void NativeModule::SetRuntimeStubs(Isolate* isolate) {
@@ -965,6 +1012,7 @@ WasmCode* NativeModule::PublishCodeLocked(std::unique_ptr<WasmCode> code) {
     bool update_code_table = !prior_code || prior_code->tier() < code->tier();
     if (update_code_table) {
       code_table_[slot_idx] = code.get();
+      if (code_ages_) code_ages_[slot_idx] = 0;
       if (prior_code) {
         WasmCodeRefScope::AddRef(prior_code);
         // The code is added to the current {WasmCodeRefScope}, hence the ref
@@ -1045,6 +1093,18 @@ bool NativeModule::HasCode(uint32_t index) const {
   return code_table_[index - module_->num_imported_functions] != nullptr;
 }
 
+std::shared_ptr<LazyDeserializationData>
+NativeModule::lazy_deserialization_data() const {
+  base::MutexGuard guard(&allocation_mutex_);
+  return lazy_deserialization_data_;
+}
+
+void NativeModule::SetLazyDeserializationData(
+    std::shared_ptr<LazyDeserializationData> data) {
+  base::MutexGuard guard(&allocation_mutex_);
+  lazy_deserialization_data_ = std::move(data);
+}
+
 WasmCode* NativeModule::CreateEmptyJumpTable(uint32_t jump_table_size) {
   // Only call this if we really need a jump table.
   DCHECK_LT(0, jump_table_size);
@@ -1146,6 +1206,9 @@ NativeModule::~NativeModule() {
   // NativeModule or freeing anything.
   compilation_state_->AbortCompilation();
   engine_->FreeNativeModule(this);
+  if (FLAG_wasm_native_module_cache) {
+    engine_->native_module_cache()->Erase(this);
+  }
   // Free the import wrapper cache before releasing the {WasmCode} objects in
   // {owned_code_}. The destructor of {WasmImportWrapperCache} still needs to
   // decrease reference counts on the {WasmCode} objects.
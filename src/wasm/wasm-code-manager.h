@@ -34,6 +34,7 @@ class Isolate;
 
 namespace wasm {
 
+class LazyDeserializationData;
 class NativeModule;
 class WasmCodeManager;
 struct WasmCompilationResult;
@@ -377,6 +378,21 @@ class V8_EXPORT_PRIVATE NativeModule final {
   // table with trampolines accordingly.
   void UseLazyStub(uint32_t func_index);
 
+  // Advances the age of all TurboFan code in the code table by one code GC
+  // cycle (see {--wasm-code-aging}). The jump table slot of code which starts
+  // aging is pointed to the lazy compile stub, such that the next call of the
+  // function reactivates its code (see {ReactivateAgedCode}). Code reaching
+  // {max_age} without being called is removed from the code table, and its
+  // function is recompiled on the next call. The code table's reference to
+  // each evicted code object is transferred to the caller.
+  std::vector<WasmCode*> AgeCode(int max_age);
+
+  // Called from lazy compilation of {func_index}. If the function still has
+  // code which was aged by {AgeCode}, resets its age, points its jump table
+  // slot back to that code, and returns true. Otherwise returns false, and
+  // the function needs to be compiled.
+  bool ReactivateAgedCode(uint32_t func_index);
+
   // Initializes all runtime stubs by setting up entry addresses in the runtime
   // stub table. It must be called exactly once per native module before adding
   // other WasmCode so that runtime stub ids can be resolved during relocation.
@@ -389,6 +405,12 @@ class V8_EXPORT_PRIVATE NativeModule final {
   WasmCode* GetCode(uint32_t index) const;
   bool HasCode(uint32_t index) const;
 
+  // Serialized code of functions which are only deserialized on their first
+  // call (see {--wasm-lazy-deserialization}). Returns null if this module was
+  // not deserialized lazily, or once all of its functions were installed.
+  std::shared_ptr<LazyDeserializationData> lazy_deserialization_data() const;
+  void SetLazyDeserializationData(std::shared_ptr<LazyDeserializationData>);
+
   Address runtime_stub_entry(WasmCode::RuntimeStubId index) const {
     DCHECK_LT(index, WasmCode::kRuntimeStubCount);
     Address entry_address = runtime_stub_entries_[index];
@@ -583,6 +605,16 @@ class V8_EXPORT_PRIVATE NativeModule final {
   // this module marking those functions that have been redirected.
   std::unique_ptr<uint8_t[]> interpreter_redirections_;
 
+  // Null until the first call to {AgeCode}, otherwise the number of code GCs
+  // since the code in each slot of {code_table_} was installed or last called.
+  // The jump table slot of code with a non-zero age points to the lazy compile
+  // stub.
+  std::unique_ptr<uint8_t[]> code_ages_;
+
+  // Serialized code of not yet deserialized functions, see
+  // {lazy_deserialization_data()}.
+  std::shared_ptr<LazyDeserializationData> lazy_deserialization_data_;
+
   // End of fields protected by {allocation_mutex_}.
   //////////////////////////////////////////////////////////////////////////////
 
@@ -4,6 +4,8 @@
 
 #include "src/wasm/wasm-engine.h"
 
+#include "src/base/functional.h"
+#include "src/base/memory.h"
 #include "src/base/platform/time.h"
 #include "src/diagnostics/code-tracer.h"
 #include "src/diagnostics/compilation-statistics.h"
@@ -14,6 +16,7 @@
 #include "src/objects/js-promise.h"
 #include "src/objects/objects-inl.h"
 #include "src/utils/ostreams.h"
+#include "src/wasm/decoder.h"
 #include "src/wasm/function-compiler.h"
 #include "src/wasm/module-compiler.h"
 #include "src/wasm/module-decoder.h"
@@ -227,6 +230,216 @@ struct WasmEngine::NativeModuleInfo {
   int8_t num_code_gcs_triggered = 0;
 };
 
+namespace {
+
+size_t FeaturesHash(const WasmFeatures& enabled) {
+  size_t hash = 0;
+#define HASH_FEATURE(feat, ...) hash = base::hash_combine(hash, enabled.feat);
+  FOREACH_WASM_FEATURE(HASH_FEATURE, )
+#undef HASH_FEATURE
+  return hash;
+}
+
+bool FeaturesEqual(const WasmFeatures& a, const WasmFeatures& b) {
+#define COMPARE_FEATURE(feat, ...) \
+  if (a.feat != b.feat) return false;
+  FOREACH_WASM_FEATURE(COMPARE_FEATURE, )
+#undef COMPARE_FEATURE
+  return true;
+}
+
+// Hashes eight bytes at a time, such that hashing large modules stays cheap
+// compared to decoding them.
+size_t BytesHash(size_t seed, Vector<const uint8_t> bytes) {
+  size_t hash = base::hash_combine(seed, bytes.size());
+  const uint8_t* pos = bytes.begin();
+  const uint8_t* end = bytes.end();
+  for (; end - pos >= 8; pos += 8) {
+    uint64_t word =
+        base::ReadUnalignedValue<uint64_t>(reinterpret_cast<Address>(pos));
+    hash = base::hash_combine(hash, word);
+  }
+  for (; pos < end; ++pos) hash = base::hash_combine(hash, *pos);
+  return hash;
+}
+
+}  // namespace
+
+bool NativeModuleCache::Key::operator==(const Key& other) const {
+  if (hash != other.hash || bytes.size() != other.bytes.size()) return false;
+  if (!FeaturesEqual(enabled, other.enabled)) return false;
+  return bytes.begin() == other.bytes.begin() ||
+         memcmp(bytes.begin(), other.bytes.begin(), bytes.size()) == 0;
+}
+
+// static
+NativeModuleCache::Key NativeModuleCache::MakeKey(
+    Vector<const uint8_t> wire_bytes, const WasmFeatures& enabled) {
+  return {BytesHash(FeaturesHash(enabled), wire_bytes), wire_bytes, enabled};
+}
+
+NativeModuleCache::LookupResult NativeModuleCache::Lookup(
+    Vector<const uint8_t> wire_bytes, const WasmFeatures& enabled,
+    CompileKind kind, Waiter* waiter,
+    std::shared_ptr<NativeModule>* native_module_out) {
+  DCHECK_EQ(kind == kAsyncCompile, waiter != nullptr);
+  Key key = MakeKey(wire_bytes, enabled);
+  base::MutexGuard lock(&mutex_);
+  while (true) {
+    auto it = map_.find(key);
+    if (it == map_.end()) {
+      Entry entry;
+      entry.owner_kind = kind;
+      entry.prefix_hash = PrefixHash(wire_bytes, enabled);
+      map_.emplace(key, std::move(entry));
+      return kOwner;
+    }
+    Entry& entry = it->second;
+    if (!entry.in_flight) {
+      if (auto native_module = entry.native_module.lock()) {
+        *native_module_out = std::move(native_module);
+        return kHit;
+      }
+      // The module died but was not erased yet. Replace the entry by an
+      // in-flight entry of the caller. The key still points to the dying
+      // module's wire bytes, so re-insert it with the caller's bytes.
+      size_t prefix_hash = entry.prefix_hash;
+      map_.erase(it);
+      Entry new_entry;
+      new_entry.owner_kind = kind;
+      new_entry.prefix_hash = prefix_hash;
+      map_.emplace(key, std::move(new_entry));
+      return kOwner;
+    }
+    if (entry.owner_kind == kAsyncCompile) {
+      // The owner of an asynchronous compilation might need the foreground
+      // thread of this caller to make progress; never block on it.
+      if (kind == kSyncCompile) return kBusy;
+      entry.waiters.push_back(waiter);
+      return kJoined;
+    }
+    // A synchronous compilation finishes on its own thread without depending
+    // on other threads; joining it is deadlock-free.
+    if (kind == kAsyncCompile) {
+      entry.waiters.push_back(waiter);
+      return kJoined;
+    }
+    cache_cv_.Wait(&mutex_);
+  }
+}
+
+std::shared_ptr<NativeModule> NativeModuleCache::Update(
+    Vector<const uint8_t> wire_bytes, const WasmFeatures& enabled,
+    std::shared_ptr<NativeModule> native_module, bool is_owner) {
+  Key key = MakeKey(wire_bytes, enabled);
+  base::MutexGuard lock(&mutex_);
+  auto it = map_.find(key);
+  if (is_owner) {
+    DCHECK(it != map_.end() && it->second.in_flight);
+    ResolveLocked(key, native_module);
+    return native_module;
+  }
+  if (!native_module) return native_module;
+  if (it != map_.end()) {
+    Entry& entry = it->second;
+    // Another compilation of these bytes is in flight; it will publish its
+    // own result.
+    if (entry.in_flight) return native_module;
+    if (auto cached = entry.native_module.lock()) return cached;
+    map_.erase(it);
+  }
+  Entry entry;
+  entry.prefix_hash = PrefixHash(wire_bytes, enabled);
+  map_.emplace(key, std::move(entry));
+  ResolveLocked(key, native_module);
+  return native_module;
+}
+
+void NativeModuleCache::ResolveLocked(
+    const Key& key, const std::shared_ptr<NativeModule>& native_module) {
+  DCHECK(!mutex_.TryLock());
+  auto it = map_.find(key);
+  DCHECK(it != map_.end());
+  Entry entry = std::move(it->second);
+  map_.erase(it);
+  std::vector<Waiter*> waiters;
+  waiters.swap(entry.waiters);
+  if (native_module) {
+    // Re-insert the key such that it refers to the wire bytes owned by the
+    // {NativeModule}, which live as long as the entry.
+    entry.native_module = native_module;
+    entry.raw_native_module = native_module.get();
+    entry.in_flight = false;
+    map_.emplace(MakeKey(native_module->wire_bytes(), key.enabled),
+                 std::move(entry));
+  }
+  for (Waiter* waiter : waiters) waiter->OnNativeModuleReady(native_module);
+  cache_cv_.NotifyAll();
+}
+
+void NativeModuleCache::RemoveWaiter(Waiter* waiter) {
+  base::MutexGuard lock(&mutex_);
+  for (auto& entry : map_) {
+    auto& waiters = entry.second.waiters;
+    waiters.erase(std::remove(waiters.begin(), waiters.end(), waiter),
+                  waiters.end());
+  }
+}
+
+bool NativeModuleCache::HasPrefix(size_t prefix_hash) {
+  base::MutexGuard lock(&mutex_);
+  for (auto& entry : map_) {
+    if (entry.second.in_flight) continue;
+    if (entry.second.prefix_hash != prefix_hash) continue;
+    if (!entry.second.native_module.expired()) return true;
+  }
+  return false;
+}
+
+void NativeModuleCache::Erase(NativeModule* native_module) {
+  base::MutexGuard lock(&mutex_);
+  auto it = map_.find(
+      MakeKey(native_module->wire_bytes(), native_module->enabled_features()));
+  if (it == map_.end()) return;
+  // The entry might have been replaced by a new in-flight entry already.
+  if (it->second.raw_native_module != native_module) return;
+  DCHECK(it->second.native_module.expired());
+  map_.erase(it);
+}
+
+NativeModuleCache::PrefixHashBuilder::PrefixHashBuilder(
+    const WasmFeatures& enabled)
+    : hash_(FeaturesHash(enabled)) {}
+
+void NativeModuleCache::PrefixHashBuilder::AddModuleHeader(
+    Vector<const uint8_t> bytes) {
+  hash_ = BytesHash(hash_, bytes);
+}
+
+void NativeModuleCache::PrefixHashBuilder::AddSection(
+    uint8_t section_code, Vector<const uint8_t> payload) {
+  hash_ = BytesHash(base::hash_combine(hash_, section_code), payload);
+}
+
+// static
+size_t NativeModuleCache::PrefixHash(Vector<const uint8_t> wire_bytes,
+                                     const WasmFeatures& enabled) {
+  PrefixHashBuilder builder(enabled);
+  constexpr size_t kModuleHeaderSize = 8;
+  if (wire_bytes.size() < kModuleHeaderSize) return builder.hash();
+  builder.AddModuleHeader(wire_bytes.SubVector(0, kModuleHeaderSize));
+  Decoder decoder(wire_bytes.begin() + kModuleHeaderSize, wire_bytes.end());
+  while (decoder.ok() && decoder.more()) {
+    uint8_t section_code = decoder.consume_u8("section code");
+    uint32_t section_length = decoder.consume_u32v("section length");
+    if (section_code == kCodeSectionCode) break;
+    if (!decoder.checkAvailable(section_length)) break;
+    builder.AddSection(section_code, {decoder.pc(), section_length});
+    decoder.consume_bytes(section_length, "section payload");
+  }
+  return builder.hash();
+}
+
 WasmEngine::WasmEngine()
     : code_manager_(&memory_tracker_, FLAG_wasm_max_code_space * MB) {}
 
@@ -305,10 +518,27 @@ Handle<WasmModuleObject> WasmEngine::FinalizeTranslatedAsmJs(
 MaybeHandle<WasmModuleObject> WasmEngine::SyncCompile(
     Isolate* isolate, const WasmFeatures& enabled, ErrorThrower* thrower,
     const ModuleWireBytes& bytes) {
+  // Check whether a module with the same wire bytes was compiled before (or is
+  // being compiled right now), possibly in another isolate.
+  bool owns_cache_entry = false;
+  if (FLAG_wasm_native_module_cache) {
+    std::shared_ptr<NativeModule> cached_native_module;
+    NativeModuleCache::LookupResult cache_result = native_module_cache_.Lookup(
+        bytes.module_bytes(), enabled, NativeModuleCache::kSyncCompile,
+        nullptr, &cached_native_module);
+    if (cache_result == NativeModuleCache::kHit) {
+      return ImportNativeModule(isolate, std::move(cached_native_module));
+    }
+    owns_cache_entry = cache_result == NativeModuleCache::kOwner;
+  }
+
   ModuleResult result =
       DecodeWasmModule(enabled, bytes.start(), bytes.end(), false, kWasmOrigin,
                        isolate->counters(), allocator());
   if (result.failed()) {
+    if (owns_cache_entry) {
+      native_module_cache_.Update(bytes.module_bytes(), enabled, nullptr, true);
+    }
     thrower->CompileFailed(result.error());
     return {};
   }
@@ -319,6 +549,20 @@ MaybeHandle<WasmModuleObject> WasmEngine::SyncCompile(
   std::shared_ptr<NativeModule> native_module =
       CompileToNativeModule(isolate, enabled, thrower,
                             std::move(result).value(), bytes, &export_wrappers);
+  if (FLAG_wasm_native_module_cache) {
+    // If another compilation of the same bytes finished in the meantime, this
+    // returns the cached module and drops ours. The export wrappers only
+    // depend on the module, so they can be reused.
+    std::shared_ptr<NativeModule> cached_native_module =
+        native_module_cache_.Update(bytes.module_bytes(), enabled,
+                                    native_module, owns_cache_entry);
+    if (cached_native_module != native_module) {
+      native_module = std::move(cached_native_module);
+      base::MutexGuard lock(&mutex_);
+      isolates_[isolate]->native_modules.insert(native_module.get());
+      native_modules_[native_module.get()]->isolates.insert(isolate);
+    }
+  }
   if (!native_module) return {};
 
   Handle<Script> script =
@@ -932,6 +1176,8 @@ void WasmEngine::PotentiallyFinishCurrentGC() {
 
   FreeDeadCodeLocked(dead_code);
 
+  if (FLAG_wasm_code_aging) AgeCodeLocked();
+
   int duration_us = 0;
   if (!current_gc_info_->start_time.IsNull()) {
     duration_us = GetGCTimeMicros(current_gc_info_->start_time);
@@ -949,6 +1195,46 @@ void WasmEngine::PotentiallyFinishCurrentGC() {
   if (next_gc_sequence_index != 0) TriggerGC(next_gc_sequence_index);
 }
 
+void WasmEngine::AgeCodeForTesting() {
+  base::MutexGuard guard(&mutex_);
+  AgeCodeLocked();
+}
+
+void WasmEngine::AgeCodeLocked() {
+  DCHECK(!mutex_.TryLock());
+  size_t evicted_size = 0;
+  for (auto& entry : native_modules_) {
+    NativeModule* native_module = entry.first;
+    NativeModuleInfo* info = entry.second.get();
+    std::vector<WasmCode*> evicted_code =
+        native_module->AgeCode(FLAG_wasm_code_aging_threshold);
+    if (evicted_code.empty()) continue;
+    size_t module_evicted_size = 0;
+    for (WasmCode* code : evicted_code) {
+      // The reference held by the code table is transferred to the set of
+      // potentially dead code. The code is freed by the next GC which does not
+      // find it on any stack. We do not trigger that GC here, since it would
+      // age (and potentially evict) all other code again right away.
+      bool added = info->potentially_dead_code.insert(code).second;
+      DCHECK(added);
+      USE(added);
+      module_evicted_size += code->instructions().size();
+    }
+    TRACE_CODE_GC("Evicted %zu code object%s (%zu bytes) of module %p.\n",
+                  evicted_code.size(), evicted_code.size() == 1 ? "" : "s",
+                  module_evicted_size, native_module);
+    for (Isolate* isolate : info->isolates) {
+      Counters* counters = isolates_[isolate]->async_counters.get();
+      counters->wasm_evicted_functions()->Increment(
+          static_cast<int>(evicted_code.size()));
+      counters->wasm_evicted_code_size()->Increment(
+          static_cast<int>(module_evicted_size));
+    }
+    evicted_size += module_evicted_size;
+  }
+  new_potentially_dead_code_size_ += evicted_size;
+}
+
 namespace {
 
 DEFINE_LAZY_LEAKY_OBJECT_GETTER(std::shared_ptr<WasmEngine>,
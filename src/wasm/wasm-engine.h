@@ -6,8 +6,11 @@
 #define V8_WASM_WASM_ENGINE_H_
 
 #include <memory>
+#include <unordered_map>
 #include <unordered_set>
 
+#include "src/base/platform/condition-variable.h"
+#include "src/base/platform/mutex.h"
 #include "src/tasks/cancelable-task.h"
 #include "src/wasm/wasm-code-manager.h"
 #include "src/wasm/wasm-memory.h"
@@ -45,6 +48,131 @@ class V8_EXPORT_PRIVATE InstantiationResultResolver {
   virtual ~InstantiationResultResolver() = default;
 };
 
+// A process-wide cache of {NativeModule}s, keyed by the module's wire bytes and
+// the enabled features it was compiled with. The cache only holds weak
+// references; an entry is removed when its {NativeModule} dies.
+// While a module is being compiled, the cache holds an in-flight entry for it,
+// so that other compilations of the same bytes can wait for the result instead
+// of compiling the module again.
+class V8_EXPORT_PRIVATE NativeModuleCache {
+ public:
+  // Whether the caller of {Lookup} compiles synchronously (blocking its
+  // thread) or as an {AsyncCompileJob}.
+  enum CompileKind : uint8_t { kSyncCompile, kAsyncCompile };
+
+  enum LookupResult : uint8_t {
+    // A live module was found and returned.
+    kHit,
+    // No module was found. The caller now owns an in-flight entry and must
+    // resolve it by calling {Update} with {is_owner == true}.
+    kOwner,
+    // Another asynchronous compilation of the same bytes is in flight. The
+    // given {Waiter} was registered and will be notified once it finishes.
+    kJoined,
+    // Another asynchronous compilation of the same bytes is in flight, and the
+    // (synchronous) caller cannot wait for it. The caller compiles the module
+    // itself and calls {Update} with {is_owner == false} afterwards.
+    kBusy
+  };
+
+  // Notified when the in-flight compilation an {AsyncCompileJob} joined
+  // finished. This is called while holding the cache mutex, from the thread
+  // that resolved the entry. The argument is null if that compilation failed.
+  class Waiter {
+   public:
+    virtual ~Waiter() = default;
+    virtual void OnNativeModuleReady(std::shared_ptr<NativeModule>) = 0;
+  };
+
+  NativeModuleCache() = default;
+
+  // Looks up a module compiled from {wire_bytes} with {enabled} features. See
+  // {LookupResult} for the possible outcomes. A synchronous caller blocks if
+  // another synchronous compilation of the same bytes is in flight. An
+  // asynchronous caller must pass a {waiter}.
+  LookupResult Lookup(Vector<const uint8_t> wire_bytes,
+                      const WasmFeatures& enabled, CompileKind kind,
+                      Waiter* waiter,
+                      std::shared_ptr<NativeModule>* native_module_out);
+
+  // Publishes the result of a compilation of {wire_bytes}. {native_module} is
+  // null if compilation failed or was aborted. If the caller owns the
+  // in-flight entry ({is_owner}), waiters are notified. Otherwise, an already
+  // cached live module is preferred over {native_module}. Returns the module
+  // that should be used by the caller.
+  std::shared_ptr<NativeModule> Update(
+      Vector<const uint8_t> wire_bytes, const WasmFeatures& enabled,
+      std::shared_ptr<NativeModule> native_module, bool is_owner);
+
+  // Unregisters a waiter which was not notified yet.
+  void RemoveWaiter(Waiter*);
+
+  // Returns true if a live module is cached whose bytes before the code
+  // section hash to {prefix_hash} (see {PrefixHash}).
+  bool HasPrefix(size_t prefix_hash);
+
+  // Called when a {NativeModule} dies; removes its entry.
+  void Erase(NativeModule*);
+
+  // Hash of the module header and all sections preceding the code section,
+  // combined with the enabled features. Streaming compilation computes the
+  // same hash incrementally via {PrefixHashBuilder}.
+  static size_t PrefixHash(Vector<const uint8_t> wire_bytes,
+                           const WasmFeatures& enabled);
+
+  class PrefixHashBuilder {
+   public:
+    explicit PrefixHashBuilder(const WasmFeatures& enabled);
+    void AddModuleHeader(Vector<const uint8_t> bytes);
+    void AddSection(uint8_t section_code, Vector<const uint8_t> payload);
+    size_t hash() const { return hash_; }
+
+   private:
+    size_t hash_;
+  };
+
+ private:
+  struct Key {
+    size_t hash;
+    // Points to the wire bytes of the compilation which created the entry,
+    // and to the wire bytes of the {NativeModule} once that was published.
+    Vector<const uint8_t> bytes;
+    WasmFeatures enabled;
+
+    bool operator==(const Key& other) const;
+  };
+
+  struct KeyHash {
+    size_t operator()(const Key& key) const { return key.hash; }
+  };
+
+  struct Entry {
+    // Null while compilation is in flight.
+    std::weak_ptr<NativeModule> native_module;
+    // Used to identify the entry of a dying module in {Erase}.
+    NativeModule* raw_native_module = nullptr;
+    size_t prefix_hash = 0;
+    bool in_flight = true;
+    CompileKind owner_kind = kSyncCompile;
+    std::vector<Waiter*> waiters;
+  };
+
+  static Key MakeKey(Vector<const uint8_t> wire_bytes,
+                     const WasmFeatures& enabled);
+
+  // Publishes {native_module} in the entry for {key}, or removes the entry if
+  // {native_module} is null. Notifies waiters. Hold {mutex_}.
+  void ResolveLocked(const Key& key,
+                     const std::shared_ptr<NativeModule>& native_module);
+
+  base::Mutex mutex_;
+  // Signalled when a synchronous in-flight entry was resolved.
+  base::ConditionVariable cache_cv_;
+  std::unordered_map<Key, Entry, KeyHash> map_;
+
+  DISALLOW_COPY_AND_ASSIGN(NativeModuleCache);
+};
+
 // The central data structure that represents an engine instance capable of
 // loading, instantiating, and executing WASM code.
 class V8_EXPORT_PRIVATE WasmEngine {
@@ -120,6 +248,8 @@ class V8_EXPORT_PRIVATE WasmEngine {
 
   WasmCodeManager* code_manager() { return &code_manager_; }
 
+  NativeModuleCache* native_module_cache() { return &native_module_cache_; }
+
   WasmMemoryTracker* memory_tracker() { return &memory_tracker_; }
 
   AccountingAllocator* allocator() { return &allocator_; }
@@ -205,6 +335,9 @@ class V8_EXPORT_PRIVATE WasmEngine {
   void FreeDeadCode(const DeadCodeMap&);
   void FreeDeadCodeLocked(const DeadCodeMap&);
 
+  // Runs one code aging pass (see {--wasm-code-aging}) outside of a GC.
+  void AgeCodeForTesting();
+
   // Call on process start and exit.
   static void InitializeOncePerProcess();
   static void GlobalTearDown();
@@ -235,10 +368,19 @@ class V8_EXPORT_PRIVATE WasmEngine {
   // calling this method.
   void PotentiallyFinishCurrentGC();
 
+  // Ages the optimized code of all native modules at the end of a GC and
+  // evicts code that was not called for {--wasm-code-aging-threshold} GCs.
+  // Hold {mutex_} when calling this method.
+  void AgeCodeLocked();
+
   WasmMemoryTracker memory_tracker_;
   WasmCodeManager code_manager_;
   AccountingAllocator allocator_;
 
+  // Shares {NativeModule}s between compilations of the same wire bytes. Only
+  // used if --wasm-native-module-cache is enabled.
+  NativeModuleCache native_module_cache_;
+
   // Task manager managing all background compile jobs. Before shut down of the
   // engine, they must all be finished because they access the allocator.
   CancelableTaskManager background_compile_task_manager_;
@@ -5,6 +5,7 @@
 #include <math.h>
 #include <stdint.h>
 #include <stdlib.h>
+#include <cstring>
 #include <limits>
 
 #include "include/v8config.h"
@@ -269,38 +270,33 @@ void float64_pow_wrapper(Address data) {
   WriteUnalignedValue<double>(data, base::ieee754::pow(x, y));
 }
 
-// Asan on Windows triggers exceptions in this function to allocate
-// shadow memory lazily. When this function is called from WebAssembly,
-// these exceptions would be handled by the trap handler before they get
-// handled by Asan, and thereby confuse the thread-in-wasm flag.
-// Therefore we disable ASAN for this function. Alternatively we could
-// reset the thread-in-wasm flag before calling this function. However,
-// as this is only a problem with Asan on Windows, we did not consider
-// it worth the overhead.
-DISABLE_ASAN void memory_copy_wrapper(Address dst, Address src, uint32_t size) {
-  // Use explicit forward and backward copy to match the required semantics for
-  // the memory.copy instruction. It is assumed that the caller of this
-  // function has already performed bounds checks, so {src + size} and
-  // {dst + size} should not overflow.
+// Asan on Windows triggers exceptions in {MemMove} and {std::memset} to
+// allocate shadow memory lazily, as both are intercepted by Asan. When these
+// functions are called from WebAssembly, the exceptions would be handled by
+// the trap handler before they get handled by Asan, and thereby confuse the
+// thread-in-wasm flag. Therefore we reset the thread-in-wasm flag around the
+// intercepted calls.
+void memory_copy_wrapper(Address dst, Address src, uint32_t size) {
+#if defined(RESET_THREAD_IN_WASM_FLAG_FOR_ASAN_ON_WINDOWS)
+  bool thread_was_in_wasm = trap_handler::IsThreadInWasm();
+  if (thread_was_in_wasm) {
+    trap_handler::ClearThreadInWasm();
+  }
+#endif
+  // {MemMove} has the semantics required by the memory.copy instruction for
+  // overlapping regions. It is assumed that the caller of this function has
+  // already performed bounds checks, so {src + size} and {dst + size} should
+  // not overflow.
   DCHECK(src + size >= src && dst + size >= dst);
-  uint8_t* dst8 = reinterpret_cast<uint8_t*>(dst);
-  uint8_t* src8 = reinterpret_cast<uint8_t*>(src);
-  if (src < dst && src + size > dst && dst + size > src) {
-    dst8 += size - 1;
-    src8 += size - 1;
-    for (; size > 0; size--) {
-      *dst8-- = *src8--;
-    }
-  } else {
-    for (; size > 0; size--) {
-      *dst8++ = *src8++;
-    }
+  MemMove(reinterpret_cast<void*>(dst), reinterpret_cast<void*>(src), size);
+#if defined(RESET_THREAD_IN_WASM_FLAG_FOR_ASAN_ON_WINDOWS)
+  if (thread_was_in_wasm) {
+    trap_handler::SetThreadInWasm();
   }
+#endif
 }
 
-// Asan on Windows triggers exceptions in this function that confuse the
-// WebAssembly trap handler, so Asan is disabled. See the comment on
-// memory_copy_wrapper above for more info.
+// See the comment on memory_copy_wrapper above.
 void memory_fill_wrapper(Address dst, uint32_t value, uint32_t size) {
 #if defined(RESET_THREAD_IN_WASM_FLAG_FOR_ASAN_ON_WINDOWS)
   bool thread_was_in_wasm = trap_handler::IsThreadInWasm();
@@ -309,15 +305,10 @@ void memory_fill_wrapper(Address dst, uint32_t value, uint32_t size) {
   }
 #endif
 
-  // Use an explicit forward copy to match the required semantics for the
-  // memory.fill instruction. It is assumed that the caller of this function
-  // has already performed bounds checks, so {dst + size} should not overflow.
+  // It is assumed that the caller of this function has already performed
+  // bounds checks, so {dst + size} should not overflow.
   DCHECK(dst + size >= dst);
-  uint8_t* dst8 = reinterpret_cast<uint8_t*>(dst);
-  uint8_t value8 = static_cast<uint8_t>(value);
-  for (; size > 0; size--) {
-    *dst8++ = value8;
-  }
+  std::memset(reinterpret_cast<void*>(dst), static_cast<uint8_t>(value), size);
 #if defined(RESET_THREAD_IN_WASM_FLAG_FOR_ASAN_ON_WINDOWS)
   if (thread_was_in_wasm) {
     trap_handler::SetThreadInWasm();
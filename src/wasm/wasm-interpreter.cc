@@ -673,7 +673,11 @@ class SideTable : public ZoneObject {
   uint32_t max_stack_height_ = 0;
 
   SideTable(Zone* zone, const WasmModule* module, InterpreterCode* code)
-      : map_(zone) {
+      : map_(zone),
+        transfers_(zone),
+        transfer_index_(zone),
+        operands_(zone),
+        lengths_(zone) {
     // Create a zone for all temporary objects.
     Zone control_transfer_zone(zone->allocator(), ZONE_NAME);
 
@@ -969,6 +973,8 @@ class SideTable : public ZoneObject {
     }
     DCHECK_EQ(0, control_stack.size());
     DCHECK_EQ(func_arity, stack_height);
+
+    PreDecode(code);
   }
 
   bool HasEntryAt(pc_t from) {
@@ -977,10 +983,106 @@ class SideTable : public ZoneObject {
   }
 
   ControlTransferEntry& Lookup(pc_t from) {
-    auto result = map_.find(from);
-    DCHECK(result != map_.end());
-    return result->second;
+    DCHECK_LT(from, transfer_index_.size());
+    uint32_t index = transfer_index_[from];
+    DCHECK_NE(kNoTransfer, index);
+    DCHECK(HasEntryAt(from));
+    return transfers_[index];
+  }
+
+  // Returns the pre-decoded immediate of the instruction at {pc}, which must
+  // be one of the instructions handled in {PreDecode} that has an immediate.
+  uint32_t Operand(pc_t pc) const {
+    DCHECK_NE(0, lengths_[pc]);
+    return operands_[pc];
+  }
+
+  // Returns the total length (opcode and immediates) of the instruction at
+  // {pc}, which must be one of the instructions handled in {PreDecode}.
+  int Length(pc_t pc) const {
+    DCHECK_NE(0, lengths_[pc]);
+    return lengths_[pc];
+  }
+
+ private:
+  static constexpr uint32_t kNoTransfer = kMaxUInt32;
+
+  // Builds dense, pc-indexed tables from {map_} and the function body, such
+  // that the interpreter can look up control transfers in constant time and
+  // does not need to decode the LEB128 immediates of the most frequently
+  // executed instructions.
+  void PreDecode(InterpreterCode* code) {
+    size_t code_size = static_cast<size_t>(code->orig_end - code->orig_start);
+    transfer_index_.assign(code_size, kNoTransfer);
+    operands_.assign(code_size, 0);
+    lengths_.assign(code_size, 0);
+    transfers_.reserve(map_.size());
+    for (auto& entry : map_) {
+      transfer_index_[entry.first] = static_cast<uint32_t>(transfers_.size());
+      transfers_.push_back(entry.second);
+    }
+    for (BytecodeIterator i(code->orig_start, code->orig_end, &code->locals);
+         i.has_next(); i.next()) {
+      pc_t pc = i.pc_offset();
+      uint32_t operand = 0;
+      uint32_t length;
+      switch (i.current()) {
+        case kExprGetLocal:
+        case kExprSetLocal:
+        case kExprTeeLocal: {
+          LocalIndexImmediate<Decoder::kNoValidate> imm(&i, i.pc());
+          operand = imm.index;
+          length = imm.length;
+          break;
+        }
+        case kExprGetGlobal:
+        case kExprSetGlobal: {
+          GlobalIndexImmediate<Decoder::kNoValidate> imm(&i, i.pc());
+          operand = imm.index;
+          length = imm.length;
+          break;
+        }
+        case kExprI32Const: {
+          ImmI32Immediate<Decoder::kNoValidate> imm(&i, i.pc());
+          operand = static_cast<uint32_t>(imm.value);
+          length = imm.length;
+          break;
+        }
+        case kExprCallFunction: {
+          CallFunctionImmediate<Decoder::kNoValidate> imm(&i, i.pc());
+          operand = imm.index;
+          length = imm.length;
+          break;
+        }
+        case kExprBlock:
+        case kExprLoop:
+        case kExprIf:
+        case kExprTry: {
+          BlockTypeImmediate<Decoder::kNoValidate> imm(kAllWasmFeatures, &i,
+                                                       i.pc());
+          length = imm.length;
+          break;
+        }
+        case kExprBr:
+        case kExprBrIf: {
+          BranchDepthImmediate<Decoder::kNoValidate> imm(&i, i.pc());
+          length = imm.length;
+          break;
+        }
+        default:
+          continue;
+      }
+      DCHECK_GT(kMaxUInt8, length);
+      operands_[pc] = operand;
+      lengths_[pc] = static_cast<uint8_t>(1 + length);
+    }
   }
+
+  ZoneVector<ControlTransferEntry> transfers_;
+  // Index into {transfers_} for each pc in {map_}, {kNoTransfer} otherwise.
+  ZoneVector<uint32_t> transfer_index_;
+  ZoneVector<uint32_t> operands_;
+  ZoneVector<uint8_t> lengths_;
 };
 
 // The main storage for interpreter code. It maps {WasmFunction} to the
@@ -1514,7 +1616,7 @@ class ThreadImpl {
     return control_transfer_entry.pc_diff;
   }
 
-  int DoBreak(InterpreterCode* code, pc_t pc, size_t depth) {
+  int DoBreak(InterpreterCode* code, pc_t pc) {
     ControlTransferEntry& control_transfer_entry = code->side_table->Lookup(pc);
     DoStackTransfer(control_transfer_entry.sp_diff,
                     control_transfer_entry.target_arity);
@@ -2839,19 +2941,15 @@ class ThreadImpl {
         case kExprBlock:
         case kExprLoop:
         case kExprTry: {
-          BlockTypeImmediate<Decoder::kNoValidate> imm(kAllWasmFeatures,
-                                                       &decoder, code->at(pc));
-          len = 1 + imm.length;
+          len = code->side_table->Length(pc);
           break;
         }
         case kExprIf: {
-          BlockTypeImmediate<Decoder::kNoValidate> imm(kAllWasmFeatures,
-                                                       &decoder, code->at(pc));
           WasmValue cond = Pop();
           bool is_true = cond.to<uint32_t>() != 0;
           if (is_true) {
             // fall through to the true block.
-            len = 1 + imm.length;
+            len = code->side_table->Length(pc);
             TRACE("  true => fallthrough\n");
           } else {
             len = LookupTargetDelta(code, pc);
@@ -2891,7 +2989,7 @@ class ThreadImpl {
           if (MatchingExceptionTag(exception, imm.index.index)) {
             imm.index.exception = &module()->exceptions[imm.index.index];
             DoUnpackException(imm.index.exception, exception);
-            len = DoBreak(code, pc, imm.depth.depth);
+            len = DoBreak(code, pc);
             TRACE("  match => @%zu\n", pc + len);
           } else {
             Push(ex);  // Exception remains on stack.
@@ -2913,38 +3011,30 @@ class ThreadImpl {
           break;
         }
         case kExprBr: {
-          BranchDepthImmediate<Decoder::kNoValidate> imm(&decoder,
-                                                         code->at(pc));
-          len = DoBreak(code, pc, imm.depth);
+          len = DoBreak(code, pc);
           TRACE("  br => @%zu\n", pc + len);
           break;
         }
         case kExprBrIf: {
-          BranchDepthImmediate<Decoder::kNoValidate> imm(&decoder,
-                                                         code->at(pc));
           WasmValue cond = Pop();
           bool is_true = cond.to<uint32_t>() != 0;
           if (is_true) {
-            len = DoBreak(code, pc, imm.depth);
+            len = DoBreak(code, pc);
             TRACE("  br_if => @%zu\n", pc + len);
           } else {
             TRACE("  false => fallthrough\n");
-            len = 1 + imm.length;
+            len = code->side_table->Length(pc);
           }
           break;
         }
         case kExprBrTable: {
           BranchTableImmediate<Decoder::kNoValidate> imm(&decoder,
                                                          code->at(pc));
-          BranchTableIterator<Decoder::kNoValidate> iterator(&decoder, imm);
           uint32_t key = Pop().to<uint32_t>();
-          uint32_t depth = 0;
           if (key >= imm.table_count) key = imm.table_count;
-          for (uint32_t i = 0; i <= key; i++) {
-            DCHECK(iterator.has_next());
-            depth = iterator.next();
-          }
-          len = key + DoBreak(code, pc + key, static_cast<size_t>(depth));
+          // The side table holds the transfer for table entry {key} at
+          // {pc + key}, so the table itself does not need to be decoded.
+          len = key + DoBreak(code, pc + key);
           TRACE("  br[%u] => @%zu\n", key, pc + key + len);
           break;
         }
@@ -2961,9 +3051,8 @@ class ThreadImpl {
           break;
         }
         case kExprI32Const: {
-          ImmI32Immediate<Decoder::kNoValidate> imm(&decoder, code->at(pc));
-          Push(WasmValue(imm.value));
-          len = 1 + imm.length;
+          Push(WasmValue(static_cast<int32_t>(code->side_table->Operand(pc))));
+          len = code->side_table->Length(pc);
           break;
         }
         case kExprI64Const: {
@@ -3001,27 +3090,27 @@ class ThreadImpl {
           break;
         }
         case kExprGetLocal: {
-          LocalIndexImmediate<Decoder::kNoValidate> imm(&decoder, code->at(pc));
+          uint32_t index = code->side_table->Operand(pc);
           HandleScope handle_scope(isolate_);  // Avoid leaking handles.
-          Push(GetStackValue(frames_.back().sp + imm.index));
-          len = 1 + imm.length;
+          Push(GetStackValue(frames_.back().sp + index));
+          len = code->side_table->Length(pc);
           break;
         }
         case kExprSetLocal: {
-          LocalIndexImmediate<Decoder::kNoValidate> imm(&decoder, code->at(pc));
+          uint32_t index = code->side_table->Operand(pc);
           HandleScope handle_scope(isolate_);  // Avoid leaking handles.
           WasmValue val = Pop();
-          SetStackValue(frames_.back().sp + imm.index, val);
-          len = 1 + imm.length;
+          SetStackValue(frames_.back().sp + index, val);
+          len = code->side_table->Length(pc);
           break;
         }
         case kExprTeeLocal: {
-          LocalIndexImmediate<Decoder::kNoValidate> imm(&decoder, code->at(pc));
+          uint32_t index = code->side_table->Operand(pc);
           HandleScope handle_scope(isolate_);  // Avoid leaking handles.
           WasmValue val = Pop();
-          SetStackValue(frames_.back().sp + imm.index, val);
+          SetStackValue(frames_.back().sp + index, val);
           Push(val);
-          len = 1 + imm.length;
+          len = code->side_table->Length(pc);
           break;
         }
         case kExprDrop: {
@@ -3029,9 +3118,8 @@ class ThreadImpl {
           break;
         }
         case kExprCallFunction: {
-          CallFunctionImmediate<Decoder::kNoValidate> imm(&decoder,
-                                                          code->at(pc));
-          InterpreterCode* target = codemap()->GetCode(imm.index);
+          InterpreterCode* target =
+              codemap()->GetCode(code->side_table->Operand(pc));
           if (target->function->imported) {
             CommitPc(pc);
             ExternalCallResult result =
@@ -3047,7 +3135,7 @@ class ThreadImpl {
                 UNREACHABLE();
               case ExternalCallResult::EXTERNAL_RETURNED:
                 PAUSE_IF_BREAK_FLAG(AfterCall);
-                len = 1 + imm.length;
+                len = code->side_table->Length(pc);
                 break;
               case ExternalCallResult::EXTERNAL_UNWOUND:
                 return;
@@ -3178,17 +3266,14 @@ class ThreadImpl {
         } break;
 
         case kExprGetGlobal: {
-          GlobalIndexImmediate<Decoder::kNoValidate> imm(&decoder,
-                                                         code->at(pc));
           HandleScope handle_scope(isolate_);
-          Push(GetGlobalValue(imm.index));
-          len = 1 + imm.length;
+          Push(GetGlobalValue(code->side_table->Operand(pc)));
+          len = code->side_table->Length(pc);
           break;
         }
         case kExprSetGlobal: {
-          GlobalIndexImmediate<Decoder::kNoValidate> imm(&decoder,
-                                                         code->at(pc));
-          const WasmGlobal* global = &module()->globals[imm.index];
+          const WasmGlobal* global =
+              &module()->globals[code->side_table->Operand(pc)];
           switch (global->type) {
 #define CASE_TYPE(wasm, ctype)                                    \
   case kWasm##wasm: {                                             \
@@ -3212,7 +3297,7 @@ class ThreadImpl {
             default:
               UNREACHABLE();
           }
-          len = 1 + imm.length;
+          len = code->side_table->Length(pc);
           break;
         }
         case kExprTableGet: {
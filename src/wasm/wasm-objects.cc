@@ -1080,22 +1080,39 @@ void WasmTableObject::UpdateDispatchTables(
         WasmInstanceObject::cast(
             dispatch_tables->get(i + kDispatchTableInstanceOffset)),
         isolate);
-    // TODO(jkummerow): Find a way to avoid recompiling wrappers.
-    wasm::NativeModule* native_module =
-        instance->module_object().native_module();
-    Address host_address = capi_function->GetHostCallTarget();
-    wasm::WasmCodeRefScope code_ref_scope;
-    wasm::WasmCode* wasm_code = compiler::CompileWasmCapiCallWrapper(
-        isolate->wasm_engine(), native_module, &sig, host_address);
-    isolate->counters()->wasm_generated_code_size()->Increment(
-        wasm_code->instructions().length());
-    isolate->counters()->wasm_reloc_size()->Increment(
-        wasm_code->reloc_info().length());
     Handle<Tuple2> tuple = isolate->factory()->NewTuple2(
         instance, capi_function, AllocationType::kOld);
     // Note that {SignatureMap::Find} may return {-1} if the signature is
     // not found; it will simply never match any check.
-    auto sig_id = instance->module()->signature_map.Find(sig);
+    const wasm::WasmModule* module = instance->module();
+    auto sig_id = module->signature_map.Find(sig);
+    if (sig_id < 0) {
+      IndirectFunctionTableEntry(instance, table_index, entry_index)
+          .Set(sig_id, kNullAddress, *tuple);
+      continue;
+    }
+    // The wrapper only depends on the signature, so look it up in the
+    // module's import wrapper cache under the module's canonical copy of
+    // the signature, and compile it only on a miss.
+    wasm::FunctionSig* canonical_sig = nullptr;
+    for (wasm::FunctionSig* module_sig : module->signatures) {
+      if (*module_sig == sig) {
+        canonical_sig = module_sig;
+        break;
+      }
+    }
+    DCHECK_NOT_NULL(canonical_sig);
+    wasm::NativeModule* native_module =
+        instance->module_object().native_module();
+    wasm::WasmImportWrapperCache::ModificationScope cache_scope(
+        native_module->import_wrapper_cache());
+    auto kind = compiler::WasmImportCallKind::kWasmToCapi;
+    wasm::WasmCode* wasm_code = cache_scope[{kind, canonical_sig}];
+    if (wasm_code == nullptr) {
+      wasm_code = wasm::CompileImportWrapper(
+          isolate->wasm_engine(), native_module, isolate->counters(), kind,
+          canonical_sig, &cache_scope);
+    }
     IndirectFunctionTableEntry(instance, table_index, entry_index)
         .Set(sig_id, wasm_code->instruction_start(), *tuple);
   }
@@ -1964,6 +1981,11 @@ WasmInstanceObject::GetOrCreateWasmExportedFunction(
   Handle<Code> wrapper;
   if (entry->IsCode()) {
     wrapper = Handle<Code>::cast(entry);
+  } else if (FLAG_wasm_lazy_js_to_wasm_wrappers &&
+             module->origin == wasm::kWasmOrigin) {
+    // The specialized wrapper is compiled on the first call, see
+    // {WasmExportedFunction::EnsureExportWrapper}.
+    wrapper = BUILTIN_CODE(isolate, WasmCompileJSToWasmWrapperLazy);
   } else {
     // The wrapper may not exist yet if no function in the exports section has
     // this signature. We compile it and store the wrapper in the module for
@@ -2211,7 +2233,11 @@ uint32_t WasmExceptionPackage::GetEncodedSize(
 bool WasmExportedFunction::IsWasmExportedFunction(Object object) {
   if (!object.IsJSFunction()) return false;
   JSFunction js_function = JSFunction::cast(object);
-  if (Code::JS_TO_WASM_FUNCTION != js_function.code().kind()) return false;
+  Code code = js_function.code();
+  if (Code::JS_TO_WASM_FUNCTION != code.kind() &&
+      code.builtin_index() != Builtins::kWasmCompileJSToWasmWrapperLazy) {
+    return false;
+  }
   DCHECK(js_function.shared().HasWasmExportedFunctionData());
   return true;
 }
@@ -2260,7 +2286,9 @@ int WasmExportedFunction::function_index() {
 Handle<WasmExportedFunction> WasmExportedFunction::New(
     Isolate* isolate, Handle<WasmInstanceObject> instance, int func_index,
     int arity, Handle<Code> export_wrapper) {
-  DCHECK_EQ(Code::JS_TO_WASM_FUNCTION, export_wrapper->kind());
+  DCHECK(Code::JS_TO_WASM_FUNCTION == export_wrapper->kind() ||
+         export_wrapper->builtin_index() ==
+             Builtins::kWasmCompileJSToWasmWrapperLazy);
   int num_imported_functions = instance->module()->num_imported_functions;
   int jump_table_offset = -1;
   if (func_index >= num_imported_functions) {
@@ -2312,6 +2340,39 @@ Handle<WasmExportedFunction> WasmExportedFunction::New(
   return Handle<WasmExportedFunction>::cast(js_function);
 }
 
+// static
+Handle<Code> WasmExportedFunction::EnsureExportWrapper(
+    Isolate* isolate, Handle<WasmExportedFunction> function) {
+  Handle<WasmExportedFunctionData> function_data(
+      function->shared().wasm_exported_function_data(), isolate);
+  Handle<Code> wrapper(function_data->wrapper_code(), isolate);
+  if (wrapper->builtin_index() != Builtins::kWasmCompileJSToWasmWrapperLazy) {
+    return wrapper;
+  }
+
+  // Another instance of the same module might have compiled the wrapper for
+  // this signature already.
+  Handle<WasmModuleObject> module_object(function->instance().module_object(),
+                                         isolate);
+  const wasm::WasmModule* module = module_object->module();
+  const wasm::WasmFunction& wasm_function =
+      module->functions[function->function_index()];
+  int wrapper_index = GetExportWrapperIndex(module, wasm_function.sig,
+                                            wasm_function.imported);
+  Handle<Object> entry =
+      FixedArray::get(module_object->export_wrappers(), wrapper_index, isolate);
+  if (entry->IsCode()) {
+    wrapper = Handle<Code>::cast(entry);
+  } else {
+    wrapper = wasm::JSToWasmWrapperCompilationUnit::CompileJSToWasmWrapper(
+        isolate, wasm_function.sig, wasm_function.imported);
+    module_object->export_wrappers().set(wrapper_index, *wrapper);
+  }
+  function_data->set_wrapper_code(*wrapper);
+  function->set_code(*wrapper);
+  return wrapper;
+}
+
 Address WasmExportedFunction::GetWasmCallTarget() {
   return instance().GetCallTarget(function_index());
 }
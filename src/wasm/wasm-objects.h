@@ -688,6 +688,12 @@ class WasmExportedFunction : public JSFunction {
       Isolate* isolate, Handle<WasmInstanceObject> instance, int func_index,
       int arity, Handle<Code> export_wrapper);
 
+  // Returns the specialized JS-to-Wasm wrapper for this function, compiling
+  // it if needed, and installs it on the function. Used when wrappers are
+  // compiled lazily (see --wasm-lazy-js-to-wasm-wrappers).
+  static Handle<Code> EnsureExportWrapper(
+      Isolate* isolate, Handle<WasmExportedFunction> function);
+
   Address GetWasmCallTarget();
 
   wasm::FunctionSig* sig();
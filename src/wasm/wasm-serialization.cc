@@ -6,6 +6,7 @@
 
 #include "src/codegen/assembler-inl.h"
 #include "src/codegen/external-reference-table.h"
+#include "src/logging/counters.h"
 #include "src/objects/objects-inl.h"
 #include "src/objects/objects.h"
 #include "src/runtime/runtime.h"
@@ -119,11 +120,16 @@ class Reader {
   const byte* pos_;
 };
 
-constexpr size_t kVersionSize = 4 * sizeof(uint32_t);
+// Version of the layout below. Bump whenever the layout changes, such that
+// data in an older layout is rejected by {IsSupportedVersion}.
+constexpr uint32_t kFormatVersion = 1;
+
+constexpr size_t kVersionSize = 5 * sizeof(uint32_t);
 
 void WriteVersion(Writer* writer) {
   writer->Write(SerializedData::kMagicNumber);
   writer->Write(Version::Hash());
+  writer->Write(kFormatVersion);
   writer->Write(static_cast<uint32_t>(CpuFeatures::SupportedFeatures()));
   writer->Write(FlagList::Hash());
 }
@@ -189,6 +195,16 @@ constexpr size_t kHeaderSize =
     sizeof(uint32_t) +  // total wasm function count
     sizeof(uint32_t);   // imported functions (index of first wasm function)
 
+// The header is followed by a table holding one entry per declared function:
+// the offset of its code entry from the start of the serialized data, or 0 if
+// no code was serialized for it. This allows to locate and relocate the code
+// of a single function without reading the code of any other function.
+constexpr size_t kCodeOffsetSize = sizeof(size_t);
+
+size_t CodeOffsetTableSize(const NativeModule* native_module) {
+  return native_module->module()->num_declared_functions * kCodeOffsetSize;
+}
+
 constexpr size_t kCodeHeaderSize =
     sizeof(size_t) +          // size of code section
     sizeof(size_t) +          // offset of constant pool
@@ -275,18 +291,22 @@ static_assert(std::is_trivially_destructible<ExternalReferenceList>::value,
 class V8_EXPORT_PRIVATE NativeModuleSerializer {
  public:
   NativeModuleSerializer() = delete;
-  NativeModuleSerializer(const NativeModule*, Vector<WasmCode* const>);
+  NativeModuleSerializer(const NativeModule*, Vector<WasmCode* const>,
+                         Vector<const OwnedVector<const byte>> pending_code);
 
   size_t Measure() const;
   bool Write(Writer* writer);
 
  private:
   size_t MeasureCode(const WasmCode*) const;
+  // Returns the code entry of a function which was not deserialized yet.
+  Vector<const byte> GetLazyCode(uint32_t declared_index) const;
   void WriteHeader(Writer* writer);
   void WriteCode(const WasmCode*, Writer* writer);
 
   const NativeModule* const native_module_;
   Vector<WasmCode* const> code_table_;
+  Vector<const OwnedVector<const byte>> pending_code_;
   bool write_called_;
 
   // Reverse lookup tables for embedded addresses.
@@ -296,8 +316,12 @@ class V8_EXPORT_PRIVATE NativeModuleSerializer {
 };
 
 NativeModuleSerializer::NativeModuleSerializer(
-    const NativeModule* module, Vector<WasmCode* const> code_table)
-    : native_module_(module), code_table_(code_table), write_called_(false) {
+    const NativeModule* module, Vector<WasmCode* const> code_table,
+    Vector<const OwnedVector<const byte>> pending_code)
+    : native_module_(module),
+      code_table_(code_table),
+      pending_code_(pending_code),
+      write_called_(false) {
   DCHECK_NOT_NULL(native_module_);
   // TODO(mtrofin): persist the export wrappers. Ideally, we'd only persist
   // the unique ones, i.e. the cache.
@@ -309,7 +333,7 @@ NativeModuleSerializer::NativeModuleSerializer(
 }
 
 size_t NativeModuleSerializer::MeasureCode(const WasmCode* code) const {
-  if (code == nullptr) return sizeof(size_t);
+  DCHECK_NOT_NULL(code);
   DCHECK(code->kind() == WasmCode::kFunction ||
          code->kind() == WasmCode::kInterpreterEntry);
   return kCodeHeaderSize + code->instructions().size() +
@@ -318,10 +342,17 @@ size_t NativeModuleSerializer::MeasureCode(const WasmCode* code) const {
              sizeof(trap_handler::ProtectedInstructionData);
 }
 
+Vector<const byte> NativeModuleSerializer::GetLazyCode(
+    uint32_t declared_index) const {
+  if (pending_code_.empty()) return {};
+  return pending_code_[declared_index].as_vector();
+}
+
 size_t NativeModuleSerializer::Measure() const {
-  size_t size = kHeaderSize;
-  for (WasmCode* code : code_table_) {
-    size += MeasureCode(code);
+  size_t size = kHeaderSize + CodeOffsetTableSize(native_module_);
+  for (uint32_t i = 0; i < code_table_.size(); ++i) {
+    WasmCode* code = code_table_[i];
+    size += code != nullptr ? MeasureCode(code) : GetLazyCode(i).size();
   }
   return size;
 }
@@ -335,10 +366,6 @@ void NativeModuleSerializer::WriteHeader(Writer* writer) {
 }
 
 void NativeModuleSerializer::WriteCode(const WasmCode* code, Writer* writer) {
-  if (code == nullptr) {
-    writer->Write(size_t{0});
-    return;
-  }
   DCHECK(code->kind() == WasmCode::kFunction ||
          code->kind() == WasmCode::kInterpreterEntry);
   // Write the size of the entire code section, followed by the code header.
@@ -435,23 +462,53 @@ bool NativeModuleSerializer::Write(Writer* writer) {
 
   WriteHeader(writer);
 
-  for (WasmCode* code : code_table_) {
-    WriteCode(code, writer);
+  // Reserve the code offset table, it is filled while writing the code.
+  byte* code_offsets = writer->current_location();
+  writer->Skip(CodeOffsetTableSize(native_module_));
+
+  for (uint32_t i = 0; i < code_table_.size(); ++i) {
+    WasmCode* code = code_table_[i];
+    Vector<const byte> lazy_code;
+    if (code == nullptr) lazy_code = GetLazyCode(i);
+    size_t offset =
+        code != nullptr || !lazy_code.empty() ? writer->bytes_written() : 0;
+    WriteUnalignedValue(
+        reinterpret_cast<Address>(code_offsets + i * kCodeOffsetSize), offset);
+    if (code != nullptr) {
+      WriteCode(code, writer);
+    } else {
+      // Functions which were not deserialized yet still have their code in
+      // serialized form, which can be copied verbatim.
+      writer->WriteVector(lazy_code);
+    }
   }
   return true;
 }
 
 WasmSerializer::WasmSerializer(NativeModule* native_module)
-    : native_module_(native_module),
-      code_table_(native_module->SnapshotCodeTable()) {}
+    : native_module_(native_module) {
+  std::shared_ptr<LazyDeserializationData> lazy_deserialization_data =
+      native_module->lazy_deserialization_data();
+  if (!lazy_deserialization_data) {
+    code_table_ = native_module->SnapshotCodeTable();
+    return;
+  }
+  // No function is installed while the snapshot is taken, so every function
+  // is either in the snapshot or in the copied code.
+  base::MutexGuard guard(lazy_deserialization_data->mutex());
+  code_table_ = native_module->SnapshotCodeTable();
+  pending_code_ = lazy_deserialization_data->CopyPendingCode();
+}
 
 size_t WasmSerializer::GetSerializedNativeModuleSize() const {
-  NativeModuleSerializer serializer(native_module_, VectorOf(code_table_));
+  NativeModuleSerializer serializer(native_module_, VectorOf(code_table_),
+                                    VectorOf(pending_code_));
   return kVersionSize + serializer.Measure();
 }
 
 bool WasmSerializer::SerializeNativeModule(Vector<byte> buffer) const {
-  NativeModuleSerializer serializer(native_module_, VectorOf(code_table_));
+  NativeModuleSerializer serializer(native_module_, VectorOf(code_table_),
+                                    VectorOf(pending_code_));
   size_t measured_size = kVersionSize + serializer.Measure();
   if (buffer.size() < measured_size) return false;
 
@@ -468,11 +525,15 @@ class V8_EXPORT_PRIVATE NativeModuleDeserializer {
   NativeModuleDeserializer() = delete;
   explicit NativeModuleDeserializer(NativeModule*);
 
-  bool Read(Reader* reader);
+  // Reads the serialized {data}, including its version header.
+  bool Read(Vector<const byte> data);
+
+  // Relocates and installs a single code entry, as found in the serialized
+  // data at the offset recorded in the code offset table.
+  void ReadCode(uint32_t fn_index, Vector<const byte> code_entry);
 
  private:
-  bool ReadHeader(Reader* reader);
-  bool ReadCode(uint32_t fn_index, Reader* reader);
+  bool ReadHeader(Reader* reader, std::vector<size_t>* code_offsets);
 
   NativeModule* const native_module_;
   bool read_called_;
@@ -483,34 +544,91 @@ class V8_EXPORT_PRIVATE NativeModuleDeserializer {
 NativeModuleDeserializer::NativeModuleDeserializer(NativeModule* native_module)
     : native_module_(native_module), read_called_(false) {}
 
-bool NativeModuleDeserializer::Read(Reader* reader) {
+bool NativeModuleDeserializer::Read(Vector<const byte> data) {
   DCHECK(!read_called_);
   read_called_ = true;
 
-  if (!ReadHeader(reader)) return false;
-  uint32_t total_fns = native_module_->num_functions();
+  Reader reader(data + kVersionSize);
+  std::vector<size_t> code_offsets;
+  if (!ReadHeader(&reader, &code_offsets)) return false;
+  size_t code_start = kVersionSize + reader.bytes_read();
+  for (size_t offset : code_offsets) {
+    if (offset == 0) continue;
+    // The entry starts with its own size, which covers the whole entry.
+    if (offset < code_start || offset > data.size() - sizeof(size_t)) {
+      return false;
+    }
+    size_t entry_size = ReadUnalignedValue<size_t>(
+        reinterpret_cast<Address>(data.begin() + offset));
+    if (entry_size < kCodeHeaderSize || entry_size > data.size() - offset) {
+      return false;
+    }
+  }
+
   uint32_t first_wasm_fn = native_module_->num_imported_functions();
-  for (uint32_t i = first_wasm_fn; i < total_fns; ++i) {
-    if (!ReadCode(i, reader)) return false;
+  if (FLAG_wasm_lazy_deserialization) {
+    // The embedder's buffer does not outlive deserialization, so the code
+    // entries are copied. They are copied one by one, such that each can be
+    // released as soon as its function is installed.
+    std::vector<OwnedVector<const byte>> code;
+    code.reserve(code_offsets.size());
+    for (uint32_t i = 0; i < code_offsets.size(); ++i) {
+      native_module_->UseLazyStub(first_wasm_fn + i);
+      Vector<const byte> entry;
+      if (code_offsets[i] != 0) {
+        size_t entry_size = ReadUnalignedValue<size_t>(
+            reinterpret_cast<Address>(data.begin() + code_offsets[i]));
+        entry = data.SubVector(code_offsets[i], code_offsets[i] + entry_size);
+      }
+      code.push_back(OwnedVector<const byte>(OwnedVector<byte>::Of(entry)));
+    }
+    native_module_->SetLazyDeserializationData(
+        std::make_shared<LazyDeserializationData>(std::move(code)));
+    return true;
+  }
+
+  for (uint32_t i = 0; i < code_offsets.size(); ++i) {
+    uint32_t fn_index = first_wasm_fn + i;
+    if (code_offsets[i] == 0) {
+      // Functions are missing if they were not compiled yet, or if they were
+      // evicted by code aging.
+      DCHECK(FLAG_wasm_lazy_compilation || FLAG_wasm_code_aging ||
+             native_module_->enabled_features().compilation_hints);
+      native_module_->UseLazyStub(fn_index);
+      continue;
+    }
+    ReadCode(fn_index, data + code_offsets[i]);
   }
-  return reader->current_size() == 0;
+  return true;
 }
 
-bool NativeModuleDeserializer::ReadHeader(Reader* reader) {
+bool NativeModuleDeserializer::ReadHeader(Reader* reader,
+                                          std::vector<size_t>* code_offsets) {
+  if (reader->current_size() < kHeaderSize) return false;
   size_t functions = reader->Read<uint32_t>();
   size_t imports = reader->Read<uint32_t>();
-  return functions == native_module_->num_functions() &&
-         imports == native_module_->num_imported_functions();
+  if (functions != native_module_->num_functions() ||
+      imports != native_module_->num_imported_functions()) {
+    return false;
+  }
+  if (reader->current_size() < CodeOffsetTableSize(native_module_)) {
+    return false;
+  }
+  uint32_t num_declared = native_module_->module()->num_declared_functions;
+  code_offsets->reserve(num_declared);
+  for (uint32_t i = 0; i < num_declared; ++i) {
+    code_offsets->push_back(reader->Read<size_t>());
+  }
+  return true;
 }
 
-bool NativeModuleDeserializer::ReadCode(uint32_t fn_index, Reader* reader) {
+void NativeModuleDeserializer::ReadCode(uint32_t fn_index,
+                                        Vector<const byte> code_entry) {
+  Reader entry_reader(code_entry);
+  Reader* reader = &entry_reader;
   size_t code_section_size = reader->Read<size_t>();
-  if (code_section_size == 0) {
-    DCHECK(FLAG_wasm_lazy_compilation ||
-           native_module_->enabled_features().compilation_hints);
-    native_module_->UseLazyStub(fn_index);
-    return true;
-  }
+  DCHECK_LE(kCodeHeaderSize, code_section_size);
+  USE(code_section_size);
   size_t constant_pool_offset = reader->Read<size_t>();
   size_t safepoint_table_offset = reader->Read<size_t>();
   size_t handler_table_offset = reader->Read<size_t>();
@@ -594,8 +712,6 @@ bool NativeModuleDeserializer::ReadCode(uint32_t fn_index, Reader* reader) {
   // Finally, flush the icache for that code.
   FlushInstructionCache(code->instructions().begin(),
                         code->instructions().size());
-
-  return true;
 }
 
 bool IsSupportedVersion(Vector<const byte> version) {
@@ -636,8 +752,7 @@ MaybeHandle<WasmModuleObject> DeserializeNativeModule(
   NativeModuleDeserializer deserializer(native_module);
   WasmCodeRefScope wasm_code_ref_scope;
 
-  Reader reader(data + kVersionSize);
-  if (!deserializer.Read(&reader)) return {};
+  if (!deserializer.Read(data)) return {};
 
   CompileJsToWasmWrappers(isolate, native_module->module(),
                           handle(module_object->export_wrappers(), isolate));
@@ -650,6 +765,77 @@ MaybeHandle<WasmModuleObject> DeserializeNativeModule(
   return module_object;
 }
 
+LazyDeserializationData::LazyDeserializationData(
+    std::vector<OwnedVector<const byte>> code)
+    : code_(std::move(code)),
+      installed_(code_.size(), false),
+      num_pending_(std::count_if(code_.begin(), code_.end(),
+                                 [](const OwnedVector<const byte>& entry) {
+                                   return !entry.empty();
+                                 })) {}
+
+Vector<const byte> LazyDeserializationData::GetCode(
+    uint32_t declared_index) const {
+  DCHECK_LT(declared_index, code_.size());
+  return code_[declared_index].as_vector();
+}
+
+bool LazyDeserializationData::IsInstalled(uint32_t declared_index) const {
+  return installed_[declared_index];
+}
+
+bool LazyDeserializationData::MarkInstalled(uint32_t declared_index) {
+  DCHECK(!installed_[declared_index]);
+  DCHECK_LT(0, num_pending_);
+  installed_[declared_index] = true;
+  code_[declared_index] = {};
+  return --num_pending_ == 0;
+}
+
+std::vector<OwnedVector<const byte>> LazyDeserializationData::CopyPendingCode()
+    const {
+  std::vector<OwnedVector<const byte>> pending_code;
+  pending_code.reserve(code_.size());
+  for (const OwnedVector<const byte>& entry : code_) {
+    pending_code.push_back(
+        OwnedVector<const byte>(OwnedVector<byte>::Of(entry.as_vector())));
+  }
+  return pending_code;
+}
+
+bool DeserializeFunctionLazily(Isolate* isolate, NativeModule* native_module,
+                               uint32_t func_index) {
+  std::shared_ptr<LazyDeserializationData> data =
+      native_module->lazy_deserialization_data();
+  if (!data) return false;
+  uint32_t declared_index =
+      func_index - native_module->num_imported_functions();
+
+  base::MutexGuard guard(data->mutex());
+  // Another isolate sharing this module might have installed the code since
+  // the lazy compile stub was entered. Installed code might also have been
+  // evicted again by code aging, in which case the function is compiled.
+  if (data->IsInstalled(declared_index)) {
+    return native_module->HasCode(func_index);
+  }
+  Vector<const byte> code_entry = data->GetCode(declared_index);
+  if (code_entry.empty()) return false;
+
+  WasmCodeRefScope code_ref_scope;
+  NativeModuleDeserializer deserializer(native_module);
+  deserializer.ReadCode(func_index, code_entry);
+  WasmCode* code = native_module->GetCode(func_index);
+  if (WasmCode::ShouldBeLogged(isolate)) code->LogCode(isolate);
+  isolate->counters()->wasm_lazily_deserialized_functions()->Increment();
+
+  // The serialized data is not needed any more once all functions with code
+  // are installed. Serializers copy the code they need upfront.
+  if (data->MarkInstalled(declared_index)) {
+    native_module->SetLazyDeserializationData(nullptr);
+  }
+  return true;
+}
+
 }  // namespace wasm
 }  // namespace internal
 }  // namespace v8
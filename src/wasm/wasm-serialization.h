@@ -5,12 +5,15 @@
 #ifndef V8_WASM_WASM_SERIALIZATION_H_
 #define V8_WASM_WASM_SERIALIZATION_H_
 
+#include "src/base/platform/mutex.h"
 #include "src/wasm/wasm-objects.h"
 
 namespace v8 {
 namespace internal {
 namespace wasm {
 
+class LazyDeserializationData;
+
 // Support for serializing WebAssembly {NativeModule} objects. This class takes
 // a snapshot of the module state at instantiation, and other code that modifies
 // the module after that won't affect the serialized result.
@@ -28,6 +31,51 @@ class V8_EXPORT_PRIVATE WasmSerializer {
  private:
   NativeModule* native_module_;
   std::vector<WasmCode*> code_table_;
+  // Serialized code of the functions which were not deserialized yet when
+  // {code_table_} was taken, such that it can be copied into the result
+  // verbatim. Empty if the module was not deserialized lazily.
+  std::vector<OwnedVector<const byte>> pending_code_;
+};
+
+// Serialized code of a {NativeModule} which was deserialized with
+// {--wasm-lazy-deserialization}. Instead of relocating all functions upfront,
+// the jump table initially points to the lazy compile stub, and each function
+// is relocated and installed from this data on its first call. Each function's
+// code entry is released once it is installed, and the data as a whole is
+// released by the {NativeModule} once all functions have been installed.
+class V8_EXPORT_PRIVATE LazyDeserializationData {
+ public:
+  // {code} holds the serialized code entry of each declared function, or an
+  // empty vector if there is no code for that function.
+  explicit LazyDeserializationData(std::vector<OwnedVector<const byte>> code);
+
+  // Serializes installation of functions.
+  base::Mutex* mutex() { return &mutex_; }
+
+  // All of the following require holding {mutex()}.
+
+  // Returns the serialized code entry of the given declared function, or an
+  // empty vector if no code was serialized for it or it was installed.
+  Vector<const byte> GetCode(uint32_t declared_index) const;
+
+  bool IsInstalled(uint32_t declared_index) const;
+
+  // Releases the code entry of an installed function. Returns true once all
+  // functions with serialized code have been installed.
+  bool MarkInstalled(uint32_t declared_index);
+
+  // Returns a copy of the code entries of all functions which were not
+  // installed yet, indexed by declared function index.
+  std::vector<OwnedVector<const byte>> CopyPendingCode() const;
+
+ private:
+  base::Mutex mutex_;
+  // Protected by {mutex_}.
+  std::vector<OwnedVector<const byte>> code_;
+  std::vector<bool> installed_;
+  size_t num_pending_;
+
+  DISALLOW_COPY_AND_ASSIGN(LazyDeserializationData);
 };
 
 // Support for deserializing WebAssembly {NativeModule} objects.
@@ -38,6 +86,11 @@ bool IsSupportedVersion(Vector<const byte> data);
 MaybeHandle<WasmModuleObject> DeserializeNativeModule(
     Isolate* isolate, Vector<const byte> data, Vector<const byte> wire_bytes);
 
+// Installs the serialized code of the given function if its module was
+// deserialized lazily. Returns false if the function needs to be compiled.
+bool DeserializeFunctionLazily(Isolate* isolate, NativeModule* native_module,
+                               uint32_t func_index);
+
 }  // namespace wasm
 }  // namespace internal
 }  // namespace v8
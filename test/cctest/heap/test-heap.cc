@@ -1180,6 +1180,89 @@ TEST(TestBytecodeFlushing) {
   }
 }
 
+TEST(TestTrimColdBytecode) {
+#ifndef V8_LITE_MODE
+  FLAG_opt = false;
+  FLAG_always_opt = false;
+  i::FLAG_optimize_for_size = false;
+#endif  // V8_LITE_MODE
+  i::FLAG_flush_bytecode = true;
+  i::FLAG_trim_cold_bytecode = true;
+  i::FLAG_enable_lazy_source_positions = true;
+  i::FLAG_stress_lazy_source_positions = false;
+
+  CcTest::InitializeVM();
+  v8::Isolate* isolate = CcTest::isolate();
+  Isolate* i_isolate = CcTest::i_isolate();
+  Factory* factory = i_isolate->factory();
+
+  {
+    v8::HandleScope scope(isolate);
+    v8::Context::New(isolate)->Enter();
+    const char* source =
+        "function foo() {"
+        "  var x = 42;"
+        "  var y = 42;"
+        "  return x + y;"
+        "};"
+        "foo()";
+    Handle<String> foo_name = factory->InternalizeUtf8String("foo");
+
+    {
+      v8::HandleScope scope(isolate);
+      CompileRun(source);
+    }
+
+    Handle<Object> func_value =
+        Object::GetProperty(i_isolate, i_isolate->global_object(), foo_name)
+            .ToHandleChecked();
+    CHECK(func_value->IsJSFunction());
+    Handle<JSFunction> function = Handle<JSFunction>::cast(func_value);
+    Handle<SharedFunctionInfo> shared(function->shared(), i_isolate);
+    CHECK(shared->is_compiled());
+    {
+      // Don't keep the bytecode alive past this scope, as live bytecode is
+      // never flushed.
+      v8::HandleScope scope(isolate);
+      Handle<BytecodeArray> bytecode(shared->GetBytecodeArray(), i_isolate);
+
+      SharedFunctionInfo::EnsureSourcePositionsAvailable(i_isolate, shared);
+      CHECK(bytecode->HasSourcePositionTable());
+
+      // Once the bytecode is cold, its source positions are discarded but the
+      // bytecode itself is kept until it is old enough to be flushed.
+      const int kColdThreshold = 2;
+      for (int i = 0; i < kColdThreshold; i++) {
+        CcTest::CollectAllGarbage();
+      }
+      CHECK(bytecode->IsCold());
+      CHECK(!bytecode->IsOld());
+      CHECK(shared->is_compiled());
+      CHECK_EQ(*bytecode, shared->GetBytecodeArray());
+      CHECK(!bytecode->HasSourcePositionTable());
+
+      // The function warms up again without being reparsed: it runs the same
+      // bytecode, which is young again, and source positions are only
+      // recollected on demand.
+      CHECK_EQ(84, CompileRun("foo()")->Int32Value(
+                       isolate->GetCurrentContext()).FromJust());
+      CHECK_EQ(*bytecode, shared->GetBytecodeArray());
+      CHECK(!bytecode->IsCold());
+      CHECK(!bytecode->HasSourcePositionTable());
+      SharedFunctionInfo::EnsureSourcePositionsAvailable(i_isolate, shared);
+      CHECK(bytecode->HasSourcePositionTable());
+    }
+
+    // Bytecode that stays unused until it is old is still flushed.
+    const int kAgingThreshold = 6;
+    for (int i = 0; i < kAgingThreshold; i++) {
+      CcTest::CollectAllGarbage();
+    }
+    CHECK(!shared->is_compiled());
+    CHECK(!function->is_compiled());
+  }
+}
+
 #ifndef V8_LITE_MODE
 
 TEST(TestOptimizeAfterBytecodeFlushingCandidate) {
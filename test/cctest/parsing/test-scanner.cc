@@ -5,6 +5,9 @@
 // Tests v8::internal::Scanner. Note that presently most unit tests for the
 // Scanner are in cctest/test-parsing.cc, rather than here.
 
+#include <string>
+
+#include "src/ast/ast-value-factory.h"
 #include "src/handles/handles-inl.h"
 #include "src/objects/objects-inl.h"
 #include "src/parsing/scanner-character-streams.h"
@@ -103,5 +106,50 @@ TEST(AllThePushbacks) {
   }
 }
 
+TEST(WordwiseScanning) {
+  // Literals, comments and indentation long enough for the word-at-a-time
+  // fast paths. Some cross the boundary of the stream's buffer and some
+  // contain characters that stop the fast path in the middle of a word.
+  std::string identifier;
+  for (int i = 0; i < 20; i++) {
+    identifier +=
+        "abcdefghijklmnopqrstuvwxyz$_0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ";
+  }
+  std::string string_body;
+  for (int i = 0; i < 40; i++) string_body += "it's a \\\"quoted\\\" string ";
+  std::string string_value;
+  for (int i = 0; i < 40; i++) string_value += "it's a \"quoted\" string ";
+  std::string source = "/* a * b ** c */ instanceof functions " + identifier +
+                       "\n        typeof // line comment *\n" +
+                       "\"" + string_body + "\" /* multi\n line */ x";
+
+  auto scanner = make_scanner(source.c_str());
+  Zone zone(CcTest::i_isolate()->allocator(), ZONE_NAME);
+  AstValueFactory ast_value_factory(
+      &zone, CcTest::i_isolate()->ast_string_constants(),
+      HashSeed(CcTest::i_isolate()));
+  auto current_literal = [&]() {
+    const AstRawString* symbol = scanner->CurrentSymbol(&ast_value_factory);
+    CHECK(symbol->is_one_byte());
+    return std::string(reinterpret_cast<const char*>(symbol->raw_data()),
+                       symbol->byte_length());
+  };
+
+  CHECK_TOK(Token::INSTANCEOF, scanner->Next());
+  CHECK_TOK(Token::IDENTIFIER, scanner->Next());
+  CHECK(scanner->CurrentLiteralEquals("functions"));
+  CHECK_TOK(Token::IDENTIFIER, scanner->Next());
+  CHECK_EQ(identifier, current_literal());
+  CHECK(scanner->HasLineTerminatorBeforeNext());
+  CHECK_TOK(Token::TYPEOF, scanner->Next());
+  CHECK(scanner->HasLineTerminatorBeforeNext());
+  CHECK_TOK(Token::STRING, scanner->Next());
+  CHECK_EQ(string_value, current_literal());
+  CHECK(scanner->HasLineTerminatorBeforeNext());
+  CHECK_TOK(Token::IDENTIFIER, scanner->Next());
+  CHECK(scanner->CurrentLiteralEquals("x"));
+  CHECK_TOK(Token::EOS, scanner->Next());
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -20738,6 +20738,122 @@ THREADED_TEST(JSONStringifyObjectWithGap) {
   ExpectString("JSON.stringify(obj, null,  '*')", *utf8);
 }
 
+namespace {
+class StringUtf8Sink : public v8::JSON::Utf8Sink {
+ public:
+  void Write(const char* data, size_t length) override {
+    CHECK_LT(0, length);
+    output.append(data, length);
+    chunks++;
+  }
+
+  std::string output;
+  int chunks = 0;
+};
+
+// Checks that StringifyToSink writes the UTF-8 encoding of what
+// JSON.stringify returns for {code}, with lone surrogates replaced by U+FFFD.
+void CheckStringifyToSink(LocalContext* context, const char* code,
+                          Local<String> gap = Local<String>()) {
+  v8::Isolate* isolate = (*context)->GetIsolate();
+  Local<Value> value = CompileRun(code);
+  Local<String> expected =
+      v8::JSON::Stringify(context->local(), value, gap).ToLocalChecked();
+  std::string expected_utf8(expected->Utf8Length(isolate), '\0');
+  expected->WriteUtf8(isolate, &expected_utf8[0],
+                      static_cast<int>(expected_utf8.size()), nullptr,
+                      v8::String::REPLACE_INVALID_UTF8 |
+                          v8::String::NO_NULL_TERMINATION);
+  StringUtf8Sink sink;
+  CHECK(v8::JSON::StringifyToSink(context->local(), value, &sink, gap)
+            .FromJust());
+  CHECK_EQ(expected_utf8, sink.output);
+}
+}  // namespace
+
+THREADED_TEST(JSONStringifyToSink) {
+  LocalContext context;
+  HandleScope scope(context->GetIsolate());
+  CheckStringifyToSink(&context, "({x: 42, y: [1, 'a', null, true]})");
+  CheckStringifyToSink(&context, "'plain string'");
+  CheckStringifyToSink(&context, "({x: {y: [1, 2]}})", v8_str("--"));
+
+  // Latin1, two-byte and non-BMP characters, including lone surrogates, which
+  // JSON.stringify escapes.
+  CheckStringifyToSink(&context, "({'\\u00e9': '\\u00ff', b: '\\u2603'})");
+  CheckStringifyToSink(&context,
+                       "['\\ud83d\\ude00', '\\ud83d', '\\ude00', 'x\\ud83d']");
+}
+
+THREADED_TEST(JSONStringifyToSinkLargeOutput) {
+  LocalContext context;
+  HandleScope scope(context->GetIsolate());
+  // Long enough to be written in several chunks, with surrogate pairs and
+  // long strings at all positions relative to the chunk boundaries.
+  CheckStringifyToSink(&context,
+                       "var records = [];"
+                       "for (var i = 0; i < 5000; i++) {"
+                       "  records.push({id: i, name: 'record ' + i,"
+                       "                text: '\\u00e9\\ud83d\\ude00'.repeat("
+                       "                    i % 7)});"
+                       "}"
+                       "records.push('x'.repeat(100000));"
+                       "records");
+  CheckStringifyToSink(&context, "records",
+                       CompileRun("'\\u2603'").As<String>());
+
+  Local<Value> records = CompileRun("records");
+  StringUtf8Sink sink;
+  CHECK(v8::JSON::StringifyToSink(context.local(), records, &sink)
+            .FromJust());
+  CHECK_LT(1, sink.chunks);
+}
+
+THREADED_TEST(JSONStringifyToSinkLoneSurrogateGap) {
+  LocalContext context;
+  HandleScope scope(context->GetIsolate());
+  // Every indentation writes a lone lead surrogate, which is encoded as
+  // U+FFFD, followed by a three-byte character. The output spans several
+  // chunks, so that these land at all positions relative to the chunk
+  // boundaries.
+  Local<String> gap = CompileRun("'\\ud800\\u4e00'").As<String>();
+  CheckStringifyToSink(&context,
+                       "var nested = [];"
+                       "for (var i = 0; i < 2000; i++) {"
+                       "  nested.push({a: [i, {b: 'x'.repeat(i % 5)}]});"
+                       "}"
+                       "nested",
+                       gap);
+
+  Local<Value> nested = CompileRun("nested");
+  StringUtf8Sink sink;
+  CHECK(v8::JSON::StringifyToSink(context.local(), nested, &sink, gap)
+            .FromJust());
+  CHECK_LT(2, sink.chunks);
+  CHECK_NE(std::string::npos, sink.output.find("\xEF\xBF\xBD\xE4\xB8\x80"));
+  CHECK_EQ(std::string::npos, sink.output.find("\xED\xA0\x80"));
+}
+
+THREADED_TEST(JSONStringifyToSinkNoResult) {
+  LocalContext context;
+  v8::Isolate* isolate = context->GetIsolate();
+  HandleScope scope(isolate);
+  StringUtf8Sink sink;
+  CHECK(!v8::JSON::StringifyToSink(context.local(), v8::Undefined(isolate),
+                                   &sink)
+             .FromJust());
+  CHECK(!v8::JSON::StringifyToSink(context.local(),
+                                   CompileRun("(function() {})"), &sink)
+             .FromJust());
+  CHECK(sink.output.empty());
+
+  v8::TryCatch try_catch(isolate);
+  Local<Value> value =
+      CompileRun("({a: 1, b: {toJSON() { throw new Error('b'); }}})");
+  CHECK(v8::JSON::StringifyToSink(context.local(), value, &sink).IsNothing());
+  CHECK(try_catch.HasCaught());
+}
+
 #if V8_OS_POSIX
 class ThreadInterruptTest {
  public:
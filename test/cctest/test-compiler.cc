@@ -33,6 +33,7 @@
 #include "src/api/api-inl.h"
 #include "src/codegen/compilation-cache.h"
 #include "src/codegen/compiler.h"
+#include "src/compiler-dispatcher/compiler-dispatcher.h"
 #include "src/diagnostics/disasm.h"
 #include "src/heap/factory.h"
 #include "src/heap/spaces.h"
@@ -873,6 +874,57 @@ TEST(DeepEagerCompilation) {
   }
 }
 
+TEST(ParallelCompileTasksForLazy) {
+  i::FLAG_always_opt = false;
+  i::FLAG_compiler_dispatcher = true;
+  i::FLAG_parallel_compile_tasks = true;
+  i::FLAG_parallel_compile_tasks_for_lazy = true;
+  CcTest::InitializeVM();
+  LocalContext env;
+  i::Isolate* isolate = CcTest::i_isolate();
+  v8::HandleScope scope(CcTest::isolate());
+  CompilerDispatcher* dispatcher = isolate->compiler_dispatcher();
+
+  // Declare one lazy top-level function more than are posted. Parallel tasks
+  // need a source that can be cloned for parallel access, such as an external
+  // string.
+  const size_t kNumFunctions = CompilerDispatcher::kMaxOutstandingLazyJobs + 1;
+  std::string source;
+  for (size_t i = 0; i < kNumFunctions; i++) {
+    source += "function f" + std::to_string(i) + "() { return " +
+              std::to_string(i) + "; }";
+  }
+  v8::Local<v8::String> external_source =
+      v8::String::NewExternalOneByte(
+          CcTest::isolate(), new StaticOneByteResource(source.c_str()))
+          .ToLocalChecked();
+  CompileRun(external_source);
+
+  // Jobs are only finalized from idle tasks, which are not run here, so all
+  // posted jobs are still outstanding.
+  for (size_t i = 0; i < kNumFunctions; i++) {
+    std::string name = "f" + std::to_string(i);
+    Handle<JSFunction> f =
+        Handle<JSFunction>::cast(GetGlobalProperty(name.c_str()));
+    Handle<SharedFunctionInfo> shared(f->shared(), isolate);
+    CHECK_EQ(i < kNumFunctions - 1, dispatcher->IsEnqueued(shared));
+  }
+
+  // Calling a posted function finishes its job instead of compiling it on the
+  // main thread.
+  CHECK_EQ(3, CompileRun("f3()")->Int32Value(env.local()).FromJust());
+  Handle<JSFunction> f3 = Handle<JSFunction>::cast(GetGlobalProperty("f3"));
+  CHECK(f3->shared().is_compiled());
+  CHECK(!dispatcher->IsEnqueued(handle(f3->shared(), isolate)));
+
+  // Functions beyond the limit are compiled lazily as usual.
+  std::string last = "f" + std::to_string(kNumFunctions - 1);
+  CHECK_EQ(static_cast<int>(kNumFunctions - 1),
+           CompileRun((last + "()").c_str())
+               ->Int32Value(env.local())
+               .FromJust());
+}
+
 TEST(DeepEagerCompilationPeakMemory) {
   i::FLAG_always_opt = false;
   CcTest::InitializeVM();
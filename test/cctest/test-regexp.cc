@@ -36,6 +36,7 @@
 #include "src/codegen/macro-assembler.h"
 #include "src/init/v8.h"
 #include "src/objects/objects-inl.h"
+#include "src/regexp/regexp-bytecodes.h"
 #include "src/regexp/regexp-compiler.h"
 #include "src/regexp/regexp-interpreter.h"
 #include "src/regexp/regexp-macro-assembler-arch.h"
@@ -1313,6 +1314,55 @@ TEST(MacroAssembler) {
   CHECK_EQ(42, captures[0]);
 }
 
+TEST(PeepholeSkipUntilChar) {
+  FLAG_regexp_peephole_optimization = true;
+  Isolate* isolate = CcTest::i_isolate();
+  Factory* factory = isolate->factory();
+  HandleScope scope(isolate);
+  Zone zone(isolate->allocator(), ZONE_NAME);
+  RegExpMacroAssemblerIrregexp m(isolate, &zone);
+  // The skip loop emitted by the Boyer-Moore lookahead for /x/.
+  Label again, found, fail;
+  m.Bind(&again);
+  m.LoadCurrentCharacter(0, &fail);
+  m.CheckCharacter('x', &found);
+  m.AdvanceCurrentPosition(1);
+  m.GoTo(&again);
+  m.Bind(&found);
+  m.WriteCurrentPositionToRegister(0, 0);
+  m.WriteCurrentPositionToRegister(1, 1);
+  m.Succeed();
+  m.Bind(&fail);
+  m.Fail();
+
+  Handle<String> source = factory->NewStringFromStaticChars("x");
+  Handle<ByteArray> array = Handle<ByteArray>::cast(m.GetCode(source));
+  // The three instructions of the loop are fused into a single
+  // SKIP_UNTIL_CHAR; the remaining 28 bytes are copied unchanged.
+  CHECK_EQ(BC_SKIP_UNTIL_CHAR, array->get_int(0) & BYTECODE_MASK);
+  CHECK_EQ(BC_SKIP_UNTIL_CHAR_LENGTH + 28, array->length());
+
+  int captures[2];
+  Handle<String> match = factory->NewStringFromStaticChars("abcxyz");
+  CHECK_EQ(IrregexpInterpreter::SUCCESS,
+           IrregexpInterpreter::Match(isolate, array, match, captures, 0));
+  CHECK_EQ(3, captures[0]);
+  CHECK_EQ(4, captures[1]);
+
+  const uc16 two_byte[] = {0x2603, 'a', 'x'};
+  Handle<String> match_16 =
+      factory->NewStringFromTwoByte(Vector<const uc16>(two_byte, 3))
+          .ToHandleChecked();
+  CHECK_EQ(IrregexpInterpreter::SUCCESS,
+           IrregexpInterpreter::Match(isolate, array, match_16, captures, 0));
+  CHECK_EQ(2, captures[0]);
+  CHECK_EQ(3, captures[1]);
+
+  Handle<String> no_match = factory->NewStringFromStaticChars("abcabc");
+  CHECK_EQ(IrregexpInterpreter::FAILURE,
+           IrregexpInterpreter::Match(isolate, array, no_match, captures, 0));
+}
+
 #ifndef V8_INTL_SUPPORT
 static uc32 canonicalize(uc32 c) {
   unibrow::uchar canon[unibrow::Ecma262Canonicalize::kMaxWidth];
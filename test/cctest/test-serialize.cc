@@ -2373,6 +2373,131 @@ TEST(CodeSerializerAfterExecute) {
   FLAG_always_opt = prev_always_opt_value;
 }
 
+TEST(CodeSerializerPreparseDataStatistics) {
+  // The lazy function f has an inner function, so the code cache carries its
+  // preparse data and compiling f in the second isolate doesn't preparse g.
+  const char* source =
+      "function f() {"
+      "  function g() { return 'abc'; }"
+      "  return g();"
+      "}"
+      "f() + 'def'";
+  v8::ScriptCompiler::CachedData* cache = CompileRunAndProduceCache(source);
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope(isolate2);
+    v8::Local<v8::Context> context = v8::Context::New(isolate2);
+    v8::Context::Scope context_scope(context);
+
+    v8::CodeCacheStatistics before;
+    CHECK(isolate2->GetCodeCacheStatistics(&before));
+
+    // Each Source takes ownership of its CachedData and deletes it, so the
+    // two caches don't share a buffer.
+    v8::ScriptOrigin origin(v8_str("test"));
+    uint8_t* other_buffer = NewArray<uint8_t>(cache->length);
+    MemCopy(other_buffer, cache->data, cache->length);
+    v8::ScriptCompiler::CachedData* other_cache =
+        new v8::ScriptCompiler::CachedData(
+            other_buffer, cache->length,
+            v8::ScriptCompiler::CachedData::BufferOwned);
+
+    v8::ScriptCompiler::Source source1(v8_str(source), origin, cache);
+    v8::Local<v8::UnboundScript> script =
+        v8::ScriptCompiler::CompileUnboundScript(
+            isolate2, &source1, v8::ScriptCompiler::kConsumeCodeCache)
+            .ToLocalChecked();
+    CHECK(!cache->rejected);
+    script->BindToCurrentContext()->Run(context).ToLocalChecked();
+
+    // A cache produced for different source is rejected.
+    v8::ScriptCompiler::Source source2(v8_str("'other source'"), origin,
+                                       other_cache);
+    v8::ScriptCompiler::CompileUnboundScript(
+        isolate2, &source2, v8::ScriptCompiler::kConsumeCodeCache)
+        .ToLocalChecked();
+    CHECK(other_cache->rejected);
+
+    v8::CodeCacheStatistics after;
+    CHECK(isolate2->GetCodeCacheStatistics(&after));
+    CHECK_EQ(before.code_cache_hits() + 1, after.code_cache_hits());
+    CHECK_EQ(before.code_cache_rejects() + 1, after.code_cache_rejects());
+    CHECK_LE(before.lazy_compiles() + 2, after.lazy_compiles());
+    CHECK_LE(before.lazy_compiles_with_preparse_data() + 1,
+             after.lazy_compiles_with_preparse_data());
+  }
+  isolate2->Dispose();
+}
+
+TEST(CodeSerializerWarmUp) {
+  // Functions compiled during the warm-up end up in the code cache even if
+  // their bytecode was flushed before the cache was created.
+  bool prev_always_opt_value = FLAG_always_opt;
+  FLAG_always_opt = false;
+  const char* source =
+      "function f() { return 'abc'; }"
+      "function g() { return 'xyz'; }"
+      "f() + 'def'";
+  v8::ScriptCompiler::CachedData* cache;
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate1 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate1);
+    v8::HandleScope scope(isolate1);
+    v8::Local<v8::Context> context = v8::Context::New(isolate1);
+    v8::Context::Scope context_scope(context);
+
+    v8::ScriptCompiler::Source source1(v8_str(source),
+                                       v8::ScriptOrigin(v8_str("test")));
+    v8::Local<v8::UnboundScript> script =
+        v8::ScriptCompiler::CompileUnboundScript(isolate1, &source1)
+            .ToLocalChecked();
+    isolate1->StartCodeCacheWarmUp();
+    script->BindToCurrentContext()->Run(context).ToLocalChecked();
+    isolate1->StopCodeCacheWarmUp();
+
+    Handle<JSFunction> f = Handle<JSFunction>::cast(v8::Utils::OpenHandle(
+        *context->Global()->Get(context, v8_str("f")).ToLocalChecked()));
+    Handle<SharedFunctionInfo> shared(f->shared(), f->GetIsolate());
+    CHECK(shared->is_compiled());
+    SharedFunctionInfo::DiscardCompiled(f->GetIsolate(), shared);
+    CHECK(!shared->is_compiled());
+
+    cache = ScriptCompiler::CreateCodeCache(script);
+    CHECK(shared->is_compiled());
+  }
+  isolate1->Dispose();
+
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope(isolate2);
+    v8::Local<v8::Context> context = v8::Context::New(isolate2);
+    v8::Context::Scope context_scope(context);
+
+    v8::ScriptCompiler::Source source2(
+        v8_str(source), v8::ScriptOrigin(v8_str("test")), cache);
+    DisallowCompilation no_compile_expected(
+        reinterpret_cast<Isolate*>(isolate2));
+    v8::Local<v8::UnboundScript> script =
+        v8::ScriptCompiler::CompileUnboundScript(
+            isolate2, &source2, v8::ScriptCompiler::kConsumeCodeCache)
+            .ToLocalChecked();
+    CHECK(!cache->rejected);
+    v8::Local<v8::Value> result =
+        script->BindToCurrentContext()->Run(context).ToLocalChecked();
+    CHECK(result->Equals(context, v8_str("abcdef")).FromJust());
+  }
+  isolate2->Dispose();
+
+  FLAG_always_opt = prev_always_opt_value;
+}
+
 TEST(CodeSerializerFlagChange) {
   const char* source = "function f() { return 'abc'; }; f() + 'def'";
   v8::ScriptCompiler::CachedData* cache = CompileRunAndProduceCache(source);
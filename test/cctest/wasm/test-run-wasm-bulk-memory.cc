@@ -255,6 +255,48 @@ WASM_EXEC_TEST(MemoryCopyOutOfBounds) {
   CHECK_EQ(0xDEADBEEF, r.Call(1, 1, 0xFFFFFFFF));
 }
 
+WASM_EXEC_TEST(MemoryCopyConstantSize) {
+  // Small constant-size copies are emitted inline by the optimizing compiler.
+  EXPERIMENTAL_FLAG_SCOPE(bulk_memory);
+  WasmRunner<uint32_t, uint32_t, uint32_t> r(execution_tier);
+  byte* mem = r.builder().AddMemory(kWasmPageSize);
+  BUILD(r,
+        WASM_MEMORY_COPY(WASM_GET_LOCAL(0), WASM_GET_LOCAL(1), WASM_I32V_1(13)),
+        kExprI32Const, 0);
+
+  const byte data[] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13};
+  memcpy(mem, data, sizeof(data));
+
+  CHECK_EQ(0, r.Call(100, 0));
+  CheckMemoryEquals(r.builder(), 100, {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12,
+                                       13});
+
+  // Overlapping copy with source < destination.
+  r.builder().BlankMemory();
+  memcpy(mem, data, sizeof(data));
+  CHECK_EQ(0, r.Call(3, 0));
+  CheckMemoryEqualsFollowedByZeroes(
+      r.builder(), {1, 2, 3, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13});
+
+  // Overlapping copy with destination < source.
+  r.builder().BlankMemory();
+  memcpy(mem + 3, data, sizeof(data));
+  CHECK_EQ(0, r.Call(0, 3));
+  CheckMemoryEqualsFollowedByZeroes(
+      r.builder(), {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 11, 12, 13});
+
+  // Copy up to the end of memory is OK.
+  CHECK_EQ(0, r.Call(kWasmPageSize - 13, 0));
+
+  // Partially out-of-bounds copies write up to the out-of-bounds access.
+  r.builder().BlankMemory();
+  memcpy(mem, data, sizeof(data));
+  CHECK_EQ(0xDEADBEEF, r.Call(kWasmPageSize - 5, 0));
+  CheckMemoryEquals(r.builder(), kWasmPageSize - 5, {1, 2, 3, 4, 5});
+  CHECK_EQ(0xDEADBEEF, r.Call(0, kWasmPageSize - 12));
+  CHECK_EQ(0xDEADBEEF, r.Call(0xFFFFFFFF, 0));
+}
+
 WASM_EXEC_TEST(MemoryFill) {
   EXPERIMENTAL_FLAG_SCOPE(bulk_memory);
   WasmRunner<uint32_t, uint32_t, uint32_t, uint32_t> r(execution_tier);
@@ -329,6 +371,32 @@ WASM_EXEC_TEST(MemoryFillOutOfBounds) {
   CHECK_EQ(0xDEADBEEF, r.Call(1, v, 0xFFFFFFFF));
 }
 
+WASM_EXEC_TEST(MemoryFillConstantSize) {
+  // Small constant-size fills are emitted inline by the optimizing compiler.
+  EXPERIMENTAL_FLAG_SCOPE(bulk_memory);
+  WasmRunner<uint32_t, uint32_t, uint32_t> r(execution_tier);
+  r.builder().AddMemory(kWasmPageSize);
+  BUILD(r,
+        WASM_MEMORY_FILL(WASM_GET_LOCAL(0), WASM_GET_LOCAL(1), WASM_I32V_1(11)),
+        kExprI32Const, 0);
+
+  CHECK_EQ(0, r.Call(1, 0x1234));
+  const byte v = 0x34;
+  CheckMemoryEqualsFollowedByZeroes(r.builder(),
+                                    {0, v, v, v, v, v, v, v, v, v, v, v});
+
+  // Fill up to the end of memory is OK.
+  CHECK_EQ(0, r.Call(kWasmPageSize - 11, 7));
+  CheckMemoryEquals(r.builder(), kWasmPageSize - 11,
+                    {7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7});
+
+  // Partially out-of-bounds fills write up to the out-of-bounds access.
+  r.builder().BlankMemory();
+  CHECK_EQ(0xDEADBEEF, r.Call(kWasmPageSize - 3, 9));
+  CheckMemoryEquals(r.builder(), kWasmPageSize - 4, {0, 9, 9, 9});
+  CHECK_EQ(0xDEADBEEF, r.Call(0xFFFFFFFF, 9));
+}
+
 WASM_EXEC_TEST(DataDropTwice) {
   EXPERIMENTAL_FLAG_SCOPE(bulk_memory);
   WasmRunner<uint32_t> r(execution_tier);
@@ -1585,6 +1585,39 @@ WASM_EXEC_TEST(LoadMem_offset_oob) {
   }
 }
 
+WASM_EXEC_TEST(LoadMemI32_MergedBoundsChecks) {
+  FlagScope<bool> merge_bounds_checks(&FLAG_wasm_merge_bounds_checks, true);
+  WasmRunner<int32_t, uint32_t> r(execution_tier);
+  int32_t* memory =
+      r.builder().AddMemoryElems<int32_t>(kWasmPageSize / sizeof(int32_t));
+  r.builder().RandomizeMemory(1111);
+
+  // The first load checks the highest offset, which makes the checks of the
+  // following loads redundant. The last load needs its own check.
+  BUILD(r, WASM_LOAD_MEM_OFFSET(MachineType::Int32(), 8, WASM_GET_LOCAL(0)),
+        WASM_LOAD_MEM(MachineType::Int32(), WASM_GET_LOCAL(0)), kExprI32Add,
+        WASM_LOAD_MEM_OFFSET(MachineType::Int32(), 4, WASM_GET_LOCAL(0)),
+        kExprI32Add,
+        WASM_LOAD_MEM_OFFSET(MachineType::Int32(), 12, WASM_GET_LOCAL(0)),
+        kExprI32Add);
+
+  r.builder().WriteMemory(&memory[0], 1);
+  r.builder().WriteMemory(&memory[1], 20);
+  r.builder().WriteMemory(&memory[2], 300);
+  r.builder().WriteMemory(&memory[3], 4000);
+  CHECK_EQ(4321, r.Call(0u));
+
+  uint32_t last_in_bounds = kWasmPageSize - 16;
+  for (uint32_t i = 0; i < 4; ++i) {
+    r.builder().WriteMemory(&memory[last_in_bounds / sizeof(int32_t) + i], 0);
+  }
+  CHECK_EQ(0, r.Call(last_in_bounds));
+  CHECK_TRAP(r.Call(last_in_bounds + 1));
+  CHECK_TRAP(r.Call(last_in_bounds + 4));
+  CHECK_TRAP(r.Call(last_in_bounds + 8));
+  CHECK_TRAP(r.Call(kWasmPageSize));
+}
+
 WASM_EXEC_TEST(LoadMemI32_offset) {
   WasmRunner<int32_t, int32_t> r(execution_tier);
   int32_t* memory =
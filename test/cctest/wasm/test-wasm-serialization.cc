@@ -92,6 +92,23 @@ class WasmSerializationTest {
     return deserialized;
   }
 
+  // Deserializes the module and serializes the result again. With
+  // {--wasm-lazy-deserialization}, none of its functions was installed yet.
+  void Reserialize() {
+    v8::Local<v8::WasmModuleObject> deserialized_module;
+    CHECK(Deserialize().ToLocal(&deserialized_module));
+    Handle<WasmModuleObject> module_object = Handle<WasmModuleObject>::cast(
+        v8::Utils::OpenHandle(*deserialized_module));
+    CHECK_EQ(FLAG_wasm_lazy_deserialization,
+             module_object->native_module()->lazy_deserialization_data() !=
+                 nullptr);
+    v8::OwnedBuffer data = deserialized_module->GetCompiledModule().Serialize();
+    CHECK_EQ(data_.size, data.size);
+    CHECK_EQ(0, memcmp(data_.buffer.get(), data.buffer.get(), data.size));
+    data_ = std::move(data);
+    serialized_bytes_ = {data_.buffer.get(), data_.size};
+  }
+
   void DeserializeAndRun() {
     ErrorThrower thrower(current_isolate(), "");
     v8::Local<v8::WasmModuleObject> deserialized_module;
@@ -211,6 +228,29 @@ TEST(DeserializeValidModule) {
   Cleanup();
 }
 
+TEST(DeserializeValidModuleLazily) {
+  FLAG_SCOPE(wasm_lazy_deserialization);
+  WasmSerializationTest test;
+  {
+    HandleScope scope(test.current_isolate());
+    test.DeserializeAndRun();
+  }
+  Cleanup(test.current_isolate());
+  Cleanup();
+}
+
+TEST(ReserializeLazilyDeserializedModule) {
+  FLAG_SCOPE(wasm_lazy_deserialization);
+  WasmSerializationTest test;
+  {
+    HandleScope scope(test.current_isolate());
+    test.Reserialize();
+    test.DeserializeAndRun();
+  }
+  Cleanup(test.current_isolate());
+  Cleanup();
+}
+
 TEST(DeserializeMismatchingVersion) {
   WasmSerializationTest test;
   {
@@ -13,6 +13,7 @@
 #include "src/wasm/wasm-objects-inl.h"
 
 #include "test/cctest/cctest.h"
+#include "test/common/wasm/flag-utils.h"
 #include "test/common/wasm/test-signatures.h"
 #include "test/common/wasm/wasm-macro-gen.h"
 #include "test/common/wasm/wasm-module-runner.h"
@@ -362,6 +363,81 @@ TEST(SharedEngineRunThreadedTierUp) {
   for (auto& thread : threads) thread.Join();
 }
 
+TEST(SharedEngineNativeModuleCacheSync) {
+  FLAG_SCOPE(wasm_native_module_cache);
+  SharedEngine engine;
+  SharedModule module;
+  {
+    SharedEngineIsolate isolate(&engine);
+    HandleScope scope(isolate.isolate());
+    ZoneBuffer* buffer = BuildReturnConstantModule(isolate.zone(), 23);
+    Handle<WasmInstanceObject> instance = isolate.CompileAndInstantiate(buffer);
+    module = isolate.ExportInstance(instance);
+    CHECK_EQ(23, isolate.Run(instance));
+  }
+  {
+    // Compiling the same bytes in another isolate reuses the module.
+    SharedEngineIsolate isolate(&engine);
+    HandleScope scope(isolate.isolate());
+    ZoneBuffer* buffer = BuildReturnConstantModule(isolate.zone(), 23);
+    Handle<WasmInstanceObject> instance = isolate.CompileAndInstantiate(buffer);
+    CHECK_EQ(module.get(), isolate.ExportInstance(instance).get());
+    CHECK_EQ(23, isolate.Run(instance));
+  }
+  {
+    // Different bytes produce a different module.
+    SharedEngineIsolate isolate(&engine);
+    HandleScope scope(isolate.isolate());
+    ZoneBuffer* buffer = BuildReturnConstantModule(isolate.zone(), 42);
+    Handle<WasmInstanceObject> instance = isolate.CompileAndInstantiate(buffer);
+    CHECK_NE(module.get(), isolate.ExportInstance(instance).get());
+    CHECK_EQ(42, isolate.Run(instance));
+  }
+}
+
+TEST(SharedEngineNativeModuleCacheAsync) {
+  FLAG_SCOPE(wasm_native_module_cache);
+  SharedEngine engine;
+  SharedModule module;
+  {
+    SharedEngineIsolate isolate(&engine);
+    HandleScope scope(isolate.isolate());
+    ZoneBuffer* buffer = BuildReturnConstantModule(isolate.zone(), 23);
+    Handle<WasmInstanceObject> instance =
+        CompileAndInstantiateAsync(isolate, buffer);
+    module = isolate.ExportInstance(instance);
+    CHECK_EQ(23, isolate.Run(instance));
+  }
+  {
+    SharedEngineIsolate isolate(&engine);
+    HandleScope scope(isolate.isolate());
+    ZoneBuffer* buffer = BuildReturnConstantModule(isolate.zone(), 23);
+    Handle<WasmInstanceObject> instance =
+        CompileAndInstantiateAsync(isolate, buffer);
+    CHECK_EQ(module.get(), isolate.ExportInstance(instance).get());
+    CHECK_EQ(23, isolate.Run(instance));
+  }
+}
+
+TEST(SharedEngineNativeModuleCacheThreaded) {
+  FLAG_SCOPE(wasm_native_module_cache);
+  SharedEngine engine;
+  constexpr int kNumberOfThreads = 5;
+  std::list<SharedEngineThread> threads;
+  for (int i = 0; i < kNumberOfThreads; ++i) {
+    threads.emplace_back(&engine, [i](SharedEngineIsolate& isolate) {
+      HandleScope scope(isolate.isolate());
+      ZoneBuffer* buffer = BuildReturnConstantModule(isolate.zone(), 23);
+      Handle<WasmInstanceObject> instance =
+          i % 2 == 0 ? isolate.CompileAndInstantiate(buffer)
+                     : CompileAndInstantiateAsync(isolate, buffer);
+      CHECK_EQ(23, isolate.Run(instance));
+    });
+  }
+  for (auto& thread : threads) thread.Start();
+  for (auto& thread : threads) thread.Join();
+}
+
 }  // namespace test_wasm_shared_engine
 }  // namespace wasm
 }  // namespace internal
@@ -0,0 +1,107 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Payloads shaped like common API responses: a timeline of tweets with long
+// text fields, and an event catalog with many small pretty-printed objects.
+
+const iterations = 20;
+let json;
+
+new BenchmarkSuite("ParseTweets", [1000], [
+  new Benchmark("ParseTweets", false, true, iterations, Parse, TweetsSetup)
+]);
+
+new BenchmarkSuite("ParseTweetsTwoByte", [1000], [
+  new Benchmark("ParseTweetsTwoByte", false, true, iterations, Parse,
+                TweetsTwoByteSetup)
+]);
+
+new BenchmarkSuite("ParseCatalog", [1000], [
+  new Benchmark("ParseCatalog", false, true, iterations, Parse, CatalogSetup)
+]);
+
+new BenchmarkSuite("ParseNestedRecords", [1000], [
+  new Benchmark("ParseNestedRecords", false, true, iterations, Parse,
+                NestedRecordsSetup)
+]);
+
+function Tweets(text) {
+  const statuses = [];
+  for (let i = 0; i < 200; i++) {
+    statuses.push({
+      created_at: "Sun Aug 31 00:29:15 +0000 2014",
+      id: 505874924095815700 + i,
+      id_str: String(505874924095815700 + i),
+      text: text + " #" + i,
+      source: "<a href=\"https://mobile.twitter.com\" " +
+          "rel=\"nofollow\">Mobile Web (M2)</a>",
+      truncated: false,
+      user: {
+        id: 1186275104 + i,
+        name: "user name " + i,
+        screen_name: "screen_name_" + i,
+        location: "",
+        description: "A fairly long user description that goes on " +
+            "for a while, like most profile descriptions do.",
+        url: null,
+        followers_count: 262 + i,
+        friends_count: 252,
+        verified: false,
+      },
+      entities: {hashtags: [], symbols: [], urls: [], user_mentions: []},
+      retweet_count: 0,
+      favorite_count: 0,
+      lang: "en",
+    });
+  }
+  return JSON.stringify({statuses: statuses});
+}
+
+function TweetsSetup() {
+  json = Tweets("This is the text of a tweet, which can be up to one " +
+                "hundred and forty characters long, \"quoted\" and all.");
+}
+
+function TweetsTwoByteSetup() {
+  json = Tweets("\u3053\u308c\u306f\u30c4\u30a4\u30fc\u30c8\u3067\u3059\u3002" +
+                "This is the text of a tweet with some Unicode text in it.");
+}
+
+function CatalogSetup() {
+  const events = {};
+  for (let i = 0; i < 1000; i++) {
+    events[138586341 + i] = {
+      description: null,
+      id: 138586341 + i,
+      logo: "/images/UE0AAAAACEKo6QAAAAZDSVRN",
+      name: "30th Anniversary Tour",
+      subTopicIds: [337184269, 337184283],
+      subjectCode: null,
+      subtitle: null,
+      topicIds: [324846099, 107888604],
+    };
+  }
+  json = JSON.stringify({events: events}, null, 4);
+}
+
+function NestedRecordsSetup() {
+  const records = [];
+  for (let i = 0; i < 2000; i++) {
+    records.push({
+      id: i,
+      name: "record " + i,
+      owner: {id: i * 7, login: "login" + i, site_admin: false},
+      location: {lat: 52.5 + i / 1000, lng: 13.4, address: {city: "Berlin"}},
+      tags: ["a", "b"],
+    });
+  }
+  json = JSON.stringify(records);
+}
+
+function Parse() {
+  if (json == undefined) {
+    throw new Error("No test data");
+  }
+  return JSON.parse(json);
+}
@@ -0,0 +1,63 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Arrays of records that share a few shapes, serialized compactly and
+// pretty-printed.
+
+let records;
+
+new BenchmarkSuite("StringifyRecords", [1000], [
+  new Benchmark("StringifyRecords", false, true, 20, Stringify, RecordsSetup)
+]);
+
+new BenchmarkSuite("StringifyRecordsPretty", [1000], [
+  new Benchmark("StringifyRecordsPretty", false, true, 20, StringifyPretty,
+                RecordsSetup)
+]);
+
+new BenchmarkSuite("StringifyNestedRecords", [1000], [
+  new Benchmark("StringifyNestedRecords", false, true, 20, Stringify,
+                NestedRecordsSetup)
+]);
+
+function RecordsSetup() {
+  records = [];
+  for (let i = 0; i < 2000; i++) {
+    records.push({
+      id: i,
+      name: "record " + i,
+      active: i % 3 != 0,
+      score: i / 8,
+      category: null,
+      created_at: "2019-08-31T00:29:15.000Z",
+    });
+  }
+}
+
+function NestedRecordsSetup() {
+  records = [];
+  for (let i = 0; i < 1000; i++) {
+    records.push({
+      id: i,
+      name: "record " + i,
+      owner: {id: i * 7, login: "login" + i, site_admin: false},
+      location: {lat: 52.5 + i / 1000, lng: 13.4, address: {city: "Berlin"}},
+      tags: ["a", "b"],
+    });
+  }
+}
+
+function Stringify() {
+  if (records == undefined) {
+    throw new Error("No test data");
+  }
+  return JSON.stringify(records);
+}
+
+function StringifyPretty() {
+  if (records == undefined) {
+    throw new Error("No test data");
+  }
+  return JSON.stringify(records, null, 2);
+}
@@ -0,0 +1,47 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+new BenchmarkSuite("LongIdentifiers", [1000], [
+  new Benchmark("LongIdentifiers", false, true, iterations, Run, LongIdentifiersSetup)
+]);
+
+new BenchmarkSuite("IndentedCode", [1000], [
+  new Benchmark("IndentedCode", false, true, iterations, Run, IndentedCodeSetup)
+]);
+
+new BenchmarkSuite("MinifiedCode", [1000], [
+  new Benchmark("MinifiedCode", false, true, iterations, Run, MinifiedCodeSetup)
+]);
+
+function LongIdentifiersSetup() {
+  code = "var someRatherLongIdentifierName_0123456789;\n" +
+      ("someRatherLongIdentifierName_0123456789 = " +
+       "someRatherLongIdentifierName_0123456789;\n").repeat(300);
+  %FlattenString(code);
+}
+
+function IndentedCodeSetup() {
+  code = ("function f(a, b) {\n" +
+      "        if (a) {\n" +
+      "                b = a + 1;\n" +
+      "        }\n" +
+      "        return b;\n" +
+      "}\n").repeat(150);
+  %FlattenString(code);
+}
+
+function MinifiedCodeSetup() {
+  code = ("!function(e,t){var n=\"some string constant with words\"," +
+      "r='another, longer string constant with some words in it';" +
+      "e.exports=function(o){return o.concat(n,r,t)}/* keep */}" +
+      "({},[]);").repeat(150);
+  %FlattenString(code);
+}
+
+function Run() {
+  if (code == undefined) {
+    throw new Error("No test data");
+  }
+  eval(code);
+}
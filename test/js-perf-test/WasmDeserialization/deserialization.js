@@ -0,0 +1,85 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Measures cold start of a serialized wasm module, i.e. deserialization,
+// instantiation and the first call(s). Run with and without
+// --wasm-lazy-deserialization to compare eager and lazy deserialization.
+
+const kNumFunctions = 2000;
+
+// Function {i} calls function {i + 1} as long as its argument is non-zero,
+// such that calling the first function with {n} runs {n + 1} functions.
+function BuildWireBytes() {
+  function leb(value) {
+    const bytes = [];
+    do {
+      let b = value & 0x7f;
+      value >>>= 7;
+      if (value != 0) b |= 0x80;
+      bytes.push(b);
+    } while (value != 0);
+    return bytes;
+  }
+  function section(id, count, entries) {
+    const payload = leb(count).concat(entries);
+    return [id].concat(leb(payload.length), payload);
+  }
+
+  const types = [0x60, 1, 0x7f, 1, 0x7f];  // (i32) -> i32
+  const functions = new Array(kNumFunctions).fill(0);
+  const exports = [4, 0x6d, 0x61, 0x69, 0x6e, 0, 0];  // "main", function 0
+  let bodies = [];
+  for (let i = 0; i < kNumFunctions; ++i) {
+    const body = [
+      0,                                      // no locals
+      0x20, 0, 0x45, 0x04, 0x40,              // if (local0 == 0)
+      0x41, 0, 0x0f, 0x0b,                    //   return 0
+      0x20, 0, 0x41, 1, 0x6b,                 // local0 - 1
+      0x10, ...leb((i + 1) % kNumFunctions),  // call i + 1
+      0x41, i & 0x3f, 0x6a,                   // + (i & 63)
+      0x0b                                    // end
+    ];
+    bodies = bodies.concat(leb(body.length), body);
+  }
+  return new Uint8Array([0x00, 0x61, 0x73, 0x6d, 1, 0, 0, 0].concat(
+      section(1, 1, types), section(3, kNumFunctions, functions),
+      section(7, 1, exports), section(10, kNumFunctions, bodies)));
+}
+
+let wire_bytes;
+let serialized;
+
+function Setup() {
+  wire_bytes = BuildWireBytes();
+  serialized = %SerializeWasmModule(new WebAssembly.Module(wire_bytes));
+}
+
+function TearDown() {
+  wire_bytes = undefined;
+  serialized = undefined;
+}
+
+function Instantiate() {
+  const module = %DeserializeWasmModule(serialized, wire_bytes);
+  return new WebAssembly.Instance(module).exports.main;
+}
+
+function InstantiateAndCallOne() {
+  if (Instantiate()(0) != 0) throw new Error('Unexpected result');
+}
+
+function InstantiateAndCallAll() {
+  const result = Instantiate()(kNumFunctions - 1);
+  if (result < 0) throw new Error('Unexpected result');
+}
+
+function addBenchmark(name, test) {
+  new BenchmarkSuite(name, [1000],
+      [
+        new Benchmark(name, false, false, 0, test, Setup, TearDown)
+      ]);
+}
+
+addBenchmark('InstantiateAndCallOne', InstantiateAndCallOne);
+addBenchmark('InstantiateAndCallAll', InstantiateAndCallAll);
@@ -0,0 +1,96 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Small compute kernels which stress the dispatch loop of the wasm
+// interpreter (local and global accesses, constants, branches and calls).
+// Run with --wasm-interpret-all.
+
+function BuildWireBytes() {
+  function str(s) {
+    return [s.length].concat(Array.from(s, c => c.charCodeAt(0)));
+  }
+  function section(id, entries) {
+    return [id, entries.length].concat(entries);
+  }
+  function functionBody(body) {
+    return [body.length].concat(body);
+  }
+
+  // int32 sum(int32 n) { int32 acc = 0; while (n) acc += n--; return acc; }
+  const sum = [
+    1, 1, 0x7f,                    // one i32 local
+    0x02, 0x40, 0x03, 0x40,        // block, loop
+    0x20, 0, 0x45, 0x0d, 1,        //   br_if 1 (n == 0)
+    0x20, 1, 0x20, 0, 0x6a,        //   acc + n
+    0x21, 1,                       //   acc = ...
+    0x20, 0, 0x41, 1, 0x6b,        //   n - 1
+    0x22, 0, 0x0d, 0,              //   br_if 0 (n = n - 1)
+    0x0b, 0x0b,                    // end, end
+    0x20, 1, 0x0b                  // return acc
+  ];
+  // int32 fib(int32 n) { return n < 2 ? n : fib(n - 1) + fib(n - 2); }
+  const fib = [
+    0,                             // no locals
+    0x20, 0, 0x41, 2, 0x49,        // n < 2
+    0x04, 0x40, 0x20, 0, 0x0f,     // if: return n
+    0x0b,                          // end
+    0x20, 0, 0x41, 1, 0x6b, 0x10, 1,  // fib(n - 1)
+    0x20, 0, 0x41, 2, 0x6b, 0x10, 1,  // fib(n - 2)
+    0x6a, 0x0b                     // add, end
+  ];
+  // int32 count(int32 n) { while (n--) g += 3; return g; }
+  const count = [
+    0,                             // no locals
+    0x02, 0x40, 0x03, 0x40,        // block, loop
+    0x20, 0, 0x45, 0x0d, 1,        //   br_if 1 (n == 0)
+    0x23, 0, 0x41, 3, 0x6a,        //   g + 3
+    0x24, 0,                       //   g = ...
+    0x20, 0, 0x41, 1, 0x6b,        //   n - 1
+    0x22, 0, 0x0d, 0,              //   br_if 0 (n = n - 1)
+    0x0b, 0x0b,                    // end, end
+    0x23, 0, 0x0b                  // return g
+  ];
+  return new Uint8Array([0x00, 0x61, 0x73, 0x6d, 1, 0, 0, 0].concat(
+      section(1, [1, 0x60, 1, 0x7f, 1, 0x7f]),        // (i32) -> i32
+      section(3, [3, 0, 0, 0]),                       // three functions
+      section(6, [1, 0x7f, 1, 0x41, 0, 0x0b]),        // mutable i32 global
+      section(7, [3].concat(str('sum'), [0, 0], str('fib'), [0, 1],
+                            str('count'), [0, 2])),
+      section(10, [3].concat(functionBody(sum), functionBody(fib),
+                             functionBody(count)))));
+}
+
+let exports;
+
+function Setup() {
+  exports = new WebAssembly.Instance(
+      new WebAssembly.Module(BuildWireBytes())).exports;
+}
+
+function TearDown() {
+  exports = undefined;
+}
+
+function Loop() {
+  if (exports.sum(10000) != 50005000) throw new Error('Unexpected result');
+}
+
+function Calls() {
+  if (exports.fib(15) != 610) throw new Error('Unexpected result');
+}
+
+function Globals() {
+  if (exports.count(10000) <= 0) throw new Error('Unexpected result');
+}
+
+function addBenchmark(name, test) {
+  new BenchmarkSuite(name, [1000],
+      [
+        new Benchmark(name, false, false, 0, test, Setup, TearDown)
+      ]);
+}
+
+addBenchmark('Loop', Loop);
+addBenchmark('Calls', Calls);
+addBenchmark('Globals', Globals);
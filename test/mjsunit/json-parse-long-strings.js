@@ -0,0 +1,70 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// JSON.parse skips string contents and whitespace several characters at a
+// time. Place every interesting character at every offset within a word.
+
+// Two-byte fillers whose low byte looks like a quote, a backslash or a
+// control character must not stop the scan.
+const kFillers =
+    ["a", " ", "\u00e9", "\u0100", "\u2022", "\u215c", "\u0a0a"];
+
+(function TestStringTerminators() {
+  for (const filler of kFillers) {
+    for (let prefix = 0; prefix < 20; prefix++) {
+      for (let suffix = 0; suffix < 20; suffix += 3) {
+        const before = filler.repeat(prefix);
+        const after = filler.repeat(suffix);
+        assertEquals(before, JSON.parse('"' + before + '"'));
+        assertEquals(before + '"' + after,
+                     JSON.parse('"' + before + '\\"' + after + '"'));
+        assertEquals(before + "\\" + after,
+                     JSON.parse('"' + before + '\\\\' + after + '"'));
+        assertEquals(before + "\n" + after,
+                     JSON.parse('"' + before + '\\n' + after + '"'));
+        assertEquals(before + "\u0100" + after,
+                     JSON.parse('"' + before + '\\u0100' + after + '"'));
+        assertThrows(() => JSON.parse('"' + before + '\n' + after + '"'),
+                     SyntaxError);
+        assertThrows(() => JSON.parse('"' + before + '\u001f' + after + '"'),
+                     SyntaxError);
+        assertThrows(() => JSON.parse('"' + before + after), SyntaxError);
+      }
+    }
+  }
+})();
+
+(function TestTwoByteSourceWithOneByteStrings() {
+  // The source is two-byte, but the long string only contains Latin1
+  // characters.
+  const value = "x".repeat(37) + "\u00ff" + "y".repeat(11);
+  const source = '["\u0100", "' + value + '"]';
+  assertEquals(["\u0100", value], JSON.parse(source));
+})();
+
+(function TestWhitespace() {
+  const kWhitespace = [" ", "\t", "\n", "\r"];
+  for (const ws of kWhitespace) {
+    for (let n = 0; n < 40; n++) {
+      const indent = "\n" + ws.repeat(n);
+      const source = "{" + indent + '"a":' + indent + "[1," + indent + "2" +
+          indent + "]" + indent + "}" + indent;
+      assertEquals({a: [1, 2]}, JSON.parse(source));
+      // A non-breaking space is not JSON whitespace.
+      assertThrows(() => JSON.parse(indent + "\u00a0" + indent + "1"),
+                   SyntaxError);
+    }
+  }
+})();
+
+(function TestPrettyPrintedRoundTrip() {
+  const object = {
+    name: "a fairly long string value ".repeat(10),
+    nested: {list: ["one", "two", "th\"ree", "f\\our"], flag: true},
+    unicode: "\u00e4\u00f6\u00fc \u4e2d\u6587 ".repeat(5),
+  };
+  for (const indent of [0, 1, 2, 4, 8, "\t"]) {
+    assertEquals(object, JSON.parse(JSON.stringify(object, null, indent)));
+  }
+})();
@@ -0,0 +1,72 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Long enough to enable the property key cache.
+const kPadding = " ".repeat(2048);
+
+(function TestNestedSiblingsShareMaps() {
+  const records = [];
+  for (let i = 0; i < 10; i++) {
+    records.push({id: i, user: {name: "n" + i, address: {city: "c" + i}}});
+  }
+  const parsed = JSON.parse(JSON.stringify(records) + kPadding);
+  assertEquals(records, parsed);
+  for (let i = 1; i < parsed.length; i++) {
+    assertTrue(%HaveSameMap(parsed[0], parsed[i]));
+    assertTrue(%HaveSameMap(parsed[0].user, parsed[i].user));
+    assertTrue(%HaveSameMap(parsed[0].user.address, parsed[i].user.address));
+  }
+})();
+
+(function TestDivergingSiblings() {
+  const source = '[' +
+      '{"a": {"x": 1, "y": 2}, "b": {"z": 3}},' +
+      '{"a": {"x": 1, "w": 2}, "b": [1, 2]},' +
+      '{"a": {"y": 1}, "c": {"z": 3}},' +
+      '{"b": {"z": 1.5}, "a": {"x": "s", "y": {}}},' +
+      '{"a": {"0": 1, "x": {"q": 1}}, "b": {"z": 3}},' +
+      '{"a": null, "b": {"z": 3}},' +
+      '[{"a": {"x": 1}}],' +
+      '{"a": {"x": 1, "y": 2}, "b": {"z": 3}}' +
+      ']' + kPadding;
+  assertEquals([
+    {a: {x: 1, y: 2}, b: {z: 3}},
+    {a: {x: 1, w: 2}, b: [1, 2]},
+    {a: {y: 1}, c: {z: 3}},
+    {b: {z: 1.5}, a: {x: "s", y: {}}},
+    {a: {0: 1, x: {q: 1}}, b: {z: 3}},
+    {a: null, b: {z: 3}},
+    [{a: {x: 1}}],
+    {a: {x: 1, y: 2}, b: {z: 3}},
+  ], JSON.parse(source));
+})();
+
+(function TestKeyCacheCollisions() {
+  // These keys agree in length and in their first, middle and last
+  // characters.
+  const keys = ["axzb", "ayzb", "a\u0100zb", "azzb"];
+  const object = {};
+  for (const key of keys) object[key] = key;
+  const source = JSON.stringify([object, object, {nested: object}]);
+  for (const padding of ["", kPadding]) {
+    const parsed = JSON.parse(source + padding);
+    for (const key of keys) {
+      assertEquals(key, parsed[0][key]);
+      assertEquals(key, parsed[1][key]);
+      assertEquals(key, parsed[2].nested[key]);
+    }
+    assertEquals(keys, Object.keys(parsed[2].nested));
+  }
+})();
+
+(function TestManyDistinctKeys() {
+  // More distinct keys than key cache entries.
+  const object = {};
+  for (let i = 0; i < 500; i++) object["key" + i] = i;
+  const parsed = JSON.parse(JSON.stringify([object, object]) + kPadding);
+  assertEquals(object, parsed[0]);
+  assertEquals(object, parsed[1]);
+})();
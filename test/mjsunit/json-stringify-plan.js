@@ -0,0 +1,110 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Objects of the same shape share a serialization plan within a single
+// JSON.stringify call. These tests exercise plans that are reused across
+// records, and objects that change shape while they are being serialized.
+
+(function TestRecordsOfSameShape() {
+  const records = [];
+  for (let i = 0; i < 20; i++) {
+    records.push({id: i, name: "n" + i, ok: i % 2 == 0, score: i / 4,
+                  tag: null, skipped: undefined, fn() {}});
+  }
+  const json = JSON.stringify(records);
+  assertEquals('{"id":0,"name":"n0","ok":true,"score":0,"tag":null}',
+               json.substring(1, json.indexOf("}") + 1));
+  assertEquals(records.length, JSON.parse(json).length);
+  assertEquals('[\n {\n  "a": 1,\n  "b": "x"\n },\n {\n  "a": 2,\n' +
+                   '  "b": "y"\n }\n]',
+               JSON.stringify([{a: 1, b: "x"}, {a: 2, b: "y"}], null, 1));
+})();
+
+(function TestKeysThatNeedEscaping() {
+  const records = [{"a\"b": 1, "c\\d": 2, "e\nf": 3, "\u00e9": 4},
+                   {"a\"b": 5, "c\\d": 6, "e\nf": 7, "\u00e9": 8}];
+  assertEquals('[{"a\\"b":1,"c\\\\d":2,"e\\nf":3,"\u00e9":4},' +
+                   '{"a\\"b":5,"c\\\\d":6,"e\\nf":7,"\u00e9":8}]',
+               JSON.stringify(records));
+  assertEquals('[{"\u2603":1,"x":"\u2603"},{"\u2603":2,"x":"y"}]',
+               JSON.stringify([{"\u2603": 1, x: "\u2603"},
+                               {"\u2603": 2, x: "y"}]));
+})();
+
+(function TestTwoByteValueBeforePlainKey() {
+  // The result switches to a two-byte representation in the middle of the
+  // first record; the plain keys that follow must be written as two-byte.
+  const records = [{a: "\u2603", b: 1}, {a: "x", b: 2}];
+  assertEquals('[{"a":"\u2603","b":1},{"a":"x","b":2}]',
+               JSON.stringify(records));
+})();
+
+(function TestNonEnumerableAndSymbolKeys() {
+  const records = [];
+  for (let i = 0; i < 3; i++) {
+    const o = {a: i, [Symbol("s")]: i};
+    Object.defineProperty(o, "hidden", {value: i, enumerable: false});
+    o.b = i;
+    records.push(o);
+  }
+  assertEquals('[{"a":0,"b":0},{"a":1,"b":1},{"a":2,"b":2}]',
+               JSON.stringify(records));
+})();
+
+(function TestAccessors() {
+  let calls = 0;
+  function Record(i) {
+    this.a = i;
+    Object.defineProperty(this, "b", {
+      get() { calls++; return i * 2; },
+      enumerable: true,
+      configurable: true,
+    });
+  }
+  const records = [new Record(1), new Record(2)];
+  assertEquals('[{"a":1,"b":2},{"a":2,"b":4}]', JSON.stringify(records));
+  assertEquals(2, calls);
+})();
+
+(function TestShapeChangeDuringSerialization() {
+  // toJSON of a nested value changes the shape of its holder, so the rest of
+  // the holder must not be read through the old plan.
+  const holder = {a: 1, nested: null, b: 2, c: 3};
+  holder.nested = {toJSON() { delete holder.b; holder.c = "changed"; }};
+  const other = {a: 4, nested: 5, b: 6, c: 7};
+  assertEquals('[{"a":4,"nested":5,"b":6,"c":7},{"a":1,"c":"changed"}]',
+               JSON.stringify([other, holder]));
+})();
+
+(function TestReplacerFunction() {
+  const records = [{a: 1, b: "x"}, {a: 2, b: "y"}];
+  const replacer = (key, value) => key === "b" ? undefined : value;
+  assertEquals('[{"a":1},{"a":2}]', JSON.stringify(records, replacer));
+})();
+
+(function TestManyShapes() {
+  // More shapes than the plan cache has entries, interleaved.
+  const records = [];
+  for (let i = 0; i < 3; i++) {
+    for (let j = 0; j < 40; j++) {
+      const o = {};
+      o["p" + j] = i;
+      o.last = j;
+      records.push(o);
+    }
+  }
+  const parsed = JSON.parse(JSON.stringify(records));
+  for (let i = 0; i < records.length; i++) {
+    assertEquals(records[i], parsed[i]);
+  }
+})();
+
+(function TestObjectsReachedFromPrimitive() {
+  // Plans are not cached when a primitive is stringified, but objects can
+  // still be reached through the replacer.
+  const replacer = (key, value) =>
+      key === "" ? [{a: 1, b: 2}, {a: 3, b: 4}] : value;
+  assertEquals('[{"a":1,"b":2},{"a":3,"b":4}]',
+               JSON.stringify(1, replacer));
+})();
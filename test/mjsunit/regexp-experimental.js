@@ -0,0 +1,57 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --enable-experimental-regexp-engine
+
+// Captures and alternation priority.
+assertEquals(["abc", "b"], /a(b|bc)?c/.exec("abc"));
+assertEquals(["a", "a", undefined], /(a)|(b)/.exec("ab"));
+assertEquals(["foobar", "foo", "bar"], /(foo|foob)(ar|bar)/.exec("foobar"));
+assertNull(/abc/.exec("abd"));
+
+// Greedy and non-greedy quantifiers.
+assertEquals(["aaa", "aaa"], /(a*)/.exec("aaa"));
+assertEquals(["", ""], /(a*?)/.exec("aaa"));
+assertEquals(["aab", "aa"], /(a+?)b/.exec("aab"));
+assertEquals(["aaaa"], /a{2,4}/.exec("aaaaa"));
+assertEquals(["aa"], /a{2,4}?/.exec("aaaaa"));
+// Captures are reset on every iteration of a quantifier.
+assertEquals(["ab", undefined, "b"], /(?:(a)|(b))+/.exec("ab"));
+assertEquals(["ab", undefined], /(?:(a)|b)+/.exec("ab"));
+
+// Character classes, anchors and word boundaries.
+assertEquals(["x1y2"], /[a-z]\d[a-z]\d/.exec("--x1y2--"));
+assertEquals(["bar"], /^bar$/m.exec("foo\nbar\nbaz"));
+assertNull(/^bar$/.exec("foo\nbar\nbaz"));
+assertEquals(["world"], /\bw\w+\b/.exec("hello world"));
+assertEquals(["b\nc"], /b[^]c/.exec("ab\ncd"));
+assertNull(/b.c/.exec("ab\ncd"));
+
+// Sticky and global regexps.
+var re = /a/y;
+assertNull(re.exec("ba"));
+re.lastIndex = 1;
+assertEquals(["a"], re.exec("ba"));
+assertEquals(2, re.lastIndex);
+assertEquals("x-x-x", "a-aa-aaa".replace(/a+/g, "x"));
+assertEquals(["1", "22", "333"], "1 22 333".match(/\d+/g));
+assertEquals("-a-b-", "ab".replace(/x*/g, "-"));
+
+// Named groups.
+var m = /(?<year>\d{4})-(?<month>\d{2})/.exec("on 2019-07");
+assertEquals("2019", m.groups.year);
+assertEquals("07", m.groups.month);
+assertEquals("07/2019",
+             "2019-07".replace(/(?<y>\d+)-(?<m>\d+)/, "$<m>/$<y>"));
+
+// Patterns that backtrack exponentially in irregexp finish in linear time.
+var subject = "a".repeat(10000);
+assertNull(/(a+)+b/.exec(subject));
+assertNull(/(a|aa)*c/.exec(subject));
+assertEquals(10000, /(a*)*$/.exec(subject)[0].length);
+
+// Unsupported features fall back to irregexp.
+assertEquals(["aa", "a"], /(a)\1/.exec("aa"));
+assertEquals(["A"], /a/i.exec("A"));
+assertEquals(["a"], /a(?=b)/.exec("ab"));
@@ -0,0 +1,32 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --regexp-interpret-all --regexp-peephole-optimization
+
+// Skip loops over a single character (SKIP_UNTIL_CHAR).
+var subject = "a".repeat(100) + "x" + "b".repeat(100);
+assertEquals(100, subject.search(/x/));
+assertEquals(100, subject.search(/xb/));
+assertEquals(-1, subject.search(/xc/));
+assertEquals(["xbbb"], /xb{3}/.exec(subject));
+assertNull(/y/.exec(subject));
+assertEquals(101, ("☃" + subject).search(/xb/));
+
+// Skip loops over a character class (SKIP_UNTIL_BIT_IN_TABLE).
+assertEquals(100, subject.search(/[xyz]b/));
+assertEquals(["xb", "x"], /([x-z])b/.exec(subject));
+assertEquals(-1, subject.search(/[yz]b/));
+assertEquals(["Xb"], /[XYZ]b/.exec("☃" + "a".repeat(50) + "Xb"));
+
+// Loads followed by character checks (LOAD_AND_CHECK_[NOT_]CHAR).
+assertEquals(["foo", "o"], /f(o)o/.exec("barfoo"));
+assertEquals(["bar"], /foo|bar/.exec("xbarx"));
+assertEquals(["ab", "ab", "ab"], "ab ab ab".match(/ab/g));
+assertEquals("x-y-z", "x,y,z".replace(/,/g, "-"));
+assertEquals(["a", "b", "c"], "a1b2c".split(/\d/));
+
+// Backtracking into fused sequences.
+assertEquals(["aaab", "aaa"], /(a+)b/.exec("aaaaaaaab".slice(5)));
+assertEquals(["abcabc", "abc"], /([a-c]+)\1/.exec("xxabcabcyy"));
+assertEquals(["ABab", "AB"], /(ab)\1/i.exec("xABabx"));
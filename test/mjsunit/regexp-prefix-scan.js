@@ -0,0 +1,52 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --regexp-prefix-scan
+
+const filler = "INFO: all good\n".repeat(1000);
+const log = filler + "ERROR: disk full\n" + filler + "ERROR: timeout\n";
+
+// Literal prefixes followed by captures.
+const error_re = /ERROR: (\w+)/;
+let m = error_re.exec(log);
+assertEquals("disk", m[1]);
+assertEquals(filler.length, m.index);
+assertEquals(["disk", "timeout"],
+             Array.from(log.matchAll(/ERROR: (\w+)/g), m => m[1]));
+assertEquals(filler + "X full\n" + filler + "X\n",
+             log.replace(/ERROR: \w+/g, "X"));
+assertNull(/FATAL: (\w+)/.exec(log));
+
+// lastIndex is respected.
+const global_re = /ERROR: (\w+)/g;
+global_re.lastIndex = filler.length + 1;
+assertEquals("timeout", global_re.exec(log)[1]);
+assertNull(global_re.exec(log));
+
+// Zero-width assertions in front of the prefix.
+assertEquals(filler.length, log.search(/^ERROR/m));
+assertEquals(-1, log.search(/^ERROR/));
+assertEquals(filler.length, log.search(/\bERROR\b/));
+assertEquals(filler.length + 1, log.search(/(?<=E)RROR/));
+assertEquals(filler.length, log.search(/(?=E)ERROR/));
+
+// Quantified and captured prefixes.
+assertEquals(["ababc", "ab"], /(ab)+c/.exec(filler + "xababc"));
+assertEquals(["xyz", "xy"], /((x)y)z/.exec(filler + "xyz").slice(0, 2));
+
+// Patterns without a usable literal prefix.
+assertEquals(["error: x"], /error: x/i.exec(filler + "error: x"));
+assertEquals(["z"], /q|z/.exec(filler + "z"));
+assertEquals(["zzz"], /z*zzz/.exec(filler + "zzz"));
+
+// Mixed one-byte and two-byte subjects and prefixes.
+assertEquals(filler.length + 1, ("☃" + log).search(/ERROR: (\w+)/));
+assertEquals(filler.length, (filler + "☃☃ snow").search(/☃☃ (\w+)/));
+assertEquals(-1, log.search(/☃☃ (\w+)/));
+
+// Sticky regexps only match at lastIndex.
+const sticky_re = /ERROR: (\w+)/y;
+assertNull(sticky_re.exec(log));
+sticky_re.lastIndex = filler.length;
+assertEquals("disk", sticky_re.exec(log)[1]);
@@ -0,0 +1,81 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Global replace with a callback passes the match, the captures, the match
+// position, the subject and the named groups to the callback, with or without
+// going through Reflect.apply internally.
+
+function collect(re, subject) {
+  const calls = [];
+  const result = subject.replace(re, function() {
+    calls.push(Array.from(arguments));
+    return "<" + arguments[0] + ">";
+  });
+  return {result, calls};
+}
+
+(function noCaptures() {
+  const {result, calls} = collect(/b+/g, "abbcb");
+  assertEquals("a<bb>c<b>", result);
+  assertEquals([["bb", 1, "abbcb"], ["b", 4, "abbcb"]], calls);
+})();
+
+(function captures() {
+  const subject = "a1b2c3";
+  for (let n = 1; n <= 6; n++) {
+    // /(.)(\d)/g with n - 1 additional empty-matching captures.
+    const re = new RegExp("(.)(\\d)" + "()".repeat(n - 1), "g");
+    const {result, calls} = collect(re, subject);
+    assertEquals("<a1><b2><c3>", result);
+    assertEquals(3, calls.length);
+    for (let i = 0; i < 3; i++) {
+      const call = calls[i];
+      assertEquals(n + 4, call.length);
+      assertEquals(subject.substr(i * 2, 2), call[0]);
+      assertEquals(subject[i * 2], call[1]);
+      assertEquals(subject[i * 2 + 1], call[2]);
+      for (let j = 3; j <= n + 1; j++) assertEquals("", call[j]);
+      assertEquals(i * 2, call[n + 2]);
+      assertEquals(subject, call[n + 3]);
+    }
+  }
+})();
+
+(function unmatchedCaptures() {
+  const {result, calls} = collect(/(a)|(b)/g, "ab");
+  assertEquals("<a><b>", result);
+  assertEquals([["a", "a", undefined, 0, "ab"],
+                ["b", undefined, "b", 1, "ab"]], calls);
+})();
+
+(function namedCaptures() {
+  const {result, calls} = collect(/(?<key>\w+)=(?<value>\w+)/g, "x=1 y=2");
+  assertEquals("<x=1> <y=2>", result);
+  assertEquals(2, calls.length);
+  assertEquals(["y=2", "y", "2", 4, "x=1 y=2"], calls[1].slice(0, 5));
+  assertEquals("y", calls[1][5].key);
+  assertEquals("2", calls[1][5].value);
+})();
+
+(function manyMatches() {
+  // Long enough to be stored in and served from the results cache.
+  const subject = "k1=v1;".repeat(20000);
+  for (let round = 0; round < 2; round++) {
+    let count = 0;
+    const result = subject.replace(/(\w)(\d)=(\w)(\d)/g,
+                                   (m, a, b, c, d, offset, s) => {
+      assertEquals(count * 6, offset);
+      assertEquals(subject, s);
+      count++;
+      return c + d + "=" + a + b;
+    });
+    assertEquals(20000, count);
+    assertEquals("v1=k1;".repeat(20000), result);
+  }
+})();
+
+(function throwingCallback() {
+  assertThrows(() => "aaa".replace(/(a)/g, () => { throw new Error(); }),
+               Error);
+})();
@@ -0,0 +1,55 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --regexp-tier-up --regexp-tier-up-ticks=3
+// Flags: --regexp-tier-up-subject-length=100
+
+// Results must not change when a regexp tiers up from the interpreter to
+// native code.
+(function execAcrossTierUp() {
+  const re = /(a+)(b*)c/;
+  for (let i = 0; i < 10; ++i) {
+    const result = re.exec('xxaaabbc' + i);
+    assertEquals(['aaabbc', 'aaa', 'bb'], [...result]);
+    assertEquals(2, result.index);
+    assertNull(re.exec('xxbbc'));
+  }
+})();
+
+(function oneByteAndTwoByteSubjects() {
+  const re = /b(.)d/;
+  for (let i = 0; i < 10; ++i) {
+    assertEquals(['bcd', 'c'], [...re.exec('abcde')]);
+    assertEquals(['bሴd', 'ሴ'], [...re.exec('abሴde')]);
+  }
+})();
+
+(function longSubjectTiersUpRightAway() {
+  const re = /x(y+)z/;
+  const long_subject = 'a'.repeat(200) + 'xyyyz';
+  assertEquals(['xyyyz', 'yyy'], [...re.exec(long_subject)]);
+  assertEquals(['xyz', 'y'], [...re.exec('xyz')]);
+})();
+
+(function globalReplace() {
+  const re = /(\d+)/g;
+  for (let i = 0; i < 10; ++i) {
+    assertEquals('<1> <22> <333>', '1 22 333'.replace(re, '<$1>'));
+    assertEquals(['1', '22', '333'], '1 22 333'.match(re));
+  }
+})();
+
+(function tierUpWithinGlobalReplace() {
+  // The callback executes the same regexp and thereby tiers it up while
+  // the outer global replace is still running.
+  const re = /(\w)(\d)/g;
+  const subject = 'a1 b2 c3 d4 e5 f6 g7';
+  const result = subject.replace(re, (match, letter, digit) => {
+    for (let i = 0; i < 5; ++i) re.exec('z9');
+    re.lastIndex = 0;
+    return digit + letter;
+  });
+  assertEquals('1a 2b 3c 4d 5e 6f 7g', result);
+  assertEquals('1a 2b 3c 4d 5e 6f 7g', subject.replace(re, '$2$1'));
+})();
@@ -0,0 +1,40 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --wasm-code-aging --wasm-code-aging-threshold=2
+// Flags: --wasm-lazy-deserialization --no-liftoff --no-wasm-tier-up
+// Flags: --no-stress-wasm-code-gc
+
+load('test/mjsunit/wasm/wasm-module-builder.js');
+
+// Functions of a lazily deserialized module which are evicted after they were
+// installed must be compiled on their next call, even while other functions
+// were not deserialized yet.
+(function evictLazilyDeserializedFunction() {
+  print(arguments.callee.name);
+  const builder = new WasmModuleBuilder();
+  builder.addFunction('f0', kSig_i_i)
+      .addBody([kExprGetLocal, 0, ...wasmI32Const(1), kExprI32Add])
+      .exportFunc();
+  builder.addFunction('f1', kSig_i_i)
+      .addBody([kExprGetLocal, 0, ...wasmI32Const(2), kExprI32Add])
+      .exportFunc();
+  const wire_bytes = builder.toBuffer();
+  const serialized = %SerializeWasmModule(new WebAssembly.Module(wire_bytes));
+  const module = %DeserializeWasmModule(serialized, wire_bytes);
+  const exports = new WebAssembly.Instance(module).exports;
+
+  assertFalse(%IsWasmFunctionCompiled(exports.f0));
+  assertEquals(4, exports.f0(3));
+  assertTrue(%IsWasmFunctionCompiled(exports.f0));
+  %WasmAgeCode();
+  %WasmAgeCode();
+  assertFalse(%IsWasmFunctionCompiled(exports.f0));
+  assertFalse(%IsWasmFunctionCompiled(exports.f1));
+
+  assertEquals(5, exports.f0(4));
+  assertTrue(%IsWasmFunctionCompiled(exports.f0));
+  assertEquals(6, exports.f1(4));
+  assertTrue(%IsWasmFunctionCompiled(exports.f1));
+})();
@@ -0,0 +1,41 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --wasm-code-aging --wasm-code-aging-threshold=2
+// Flags: --no-wasm-lazy-deserialization --no-wasm-lazy-compilation
+// Flags: --no-liftoff --no-wasm-tier-up --no-stress-wasm-code-gc
+
+load('test/mjsunit/wasm/wasm-module-builder.js');
+
+// Functions which were evicted by code aging are serialized without code. An
+// eagerly deserialized module compiles them on their next call.
+(function serializeEvictedFunction() {
+  print(arguments.callee.name);
+  const builder = new WasmModuleBuilder();
+  builder.addFunction('hot', kSig_i_i)
+      .addBody([kExprGetLocal, 0, ...wasmI32Const(1), kExprI32Add])
+      .exportFunc();
+  builder.addFunction('cold', kSig_i_i)
+      .addBody([kExprGetLocal, 0, ...wasmI32Const(2), kExprI32Add])
+      .exportFunc();
+  const wire_bytes = builder.toBuffer();
+  const module = new WebAssembly.Module(wire_bytes);
+  let exports = new WebAssembly.Instance(module).exports;
+
+  %WasmAgeCode();
+  assertEquals(2, exports.hot(1));
+  %WasmAgeCode();
+  assertTrue(%IsWasmFunctionCompiled(exports.hot));
+  assertFalse(%IsWasmFunctionCompiled(exports.cold));
+
+  const serialized = %SerializeWasmModule(module);
+  const deserialized = %DeserializeWasmModule(serialized, wire_bytes);
+  exports = new WebAssembly.Instance(deserialized).exports;
+
+  assertTrue(%IsWasmFunctionCompiled(exports.hot));
+  assertFalse(%IsWasmFunctionCompiled(exports.cold));
+  assertEquals(3, exports.hot(2));
+  assertEquals(5, exports.cold(3));
+  assertTrue(%IsWasmFunctionCompiled(exports.cold));
+})();
@@ -0,0 +1,39 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --wasm-code-aging --wasm-code-aging-threshold=1
+// Flags: --stress-wasm-code-gc --liftoff --wasm-tier-up --expose-gc
+
+load('test/mjsunit/wasm/wasm-module-builder.js');
+
+// Tier-up produces dead Liftoff code, which (with --stress-wasm-code-gc)
+// triggers code GCs. Each of them ages the TurboFan code, which is evicted
+// right away with a threshold of 1. Evicted functions must still be callable
+// and are recompiled lazily.
+(function callEvictedFunctions() {
+  print(arguments.callee.name);
+  const builder = new WasmModuleBuilder();
+  const kNumFunctions = 20;
+  for (let i = 0; i < kNumFunctions; ++i) {
+    builder.addFunction('f' + i, kSig_i_i)
+        .addBody([kExprGetLocal, 0, ...wasmI32Const(i), kExprI32Add])
+        .exportFunc();
+  }
+  builder.addFunction('call_all', kSig_i_i)
+      .addBody([
+        kExprGetLocal, 0,
+        ...[].concat(...Array.from({length: kNumFunctions},
+                                   (_, i) => [kExprCallFunction, i]))
+      ])
+      .exportFunc();
+  const instance = builder.instantiate();
+  const kExpected = (kNumFunctions - 1) * kNumFunctions / 2;
+  for (let round = 0; round < 50; ++round) {
+    for (let i = 0; i < kNumFunctions; ++i) {
+      assertEquals(round + i, instance.exports['f' + i](round));
+    }
+    assertEquals(round + kExpected, instance.exports.call_all(round));
+    gc();
+  }
+})();
@@ -0,0 +1,63 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --wasm-code-aging --wasm-code-aging-threshold=2
+// Flags: --no-liftoff --no-wasm-tier-up --no-stress-wasm-code-gc
+
+load('test/mjsunit/wasm/wasm-module-builder.js');
+
+function instantiate() {
+  const builder = new WasmModuleBuilder();
+  const hot = builder.addFunction('hot', kSig_i_i)
+      .addBody([kExprGetLocal, 0, ...wasmI32Const(1), kExprI32Add])
+      .exportFunc();
+  const cold = builder.addFunction('cold', kSig_i_i)
+      .addBody([kExprGetLocal, 0, ...wasmI32Const(2), kExprI32Add])
+      .exportFunc();
+  builder.addFunction('call_cold', kSig_i_i)
+      .addBody([kExprGetLocal, 0, kExprCallFunction, cold.index])
+      .exportFunc();
+  return builder.instantiate();
+}
+
+(function keepCalledFunctions() {
+  print(arguments.callee.name);
+  const exports = instantiate().exports;
+  for (let i = 0; i < 5; ++i) {
+    assertEquals(i + 1, exports.hot(i));
+    %WasmAgeCode();
+    assertTrue(%IsWasmFunctionCompiled(exports.hot));
+  }
+})();
+
+(function evictUncalledFunctions() {
+  print(arguments.callee.name);
+  const exports = instantiate().exports;
+  assertTrue(%IsWasmFunctionCompiled(exports.cold));
+  %WasmAgeCode();
+  assertTrue(%IsWasmFunctionCompiled(exports.cold));
+  %WasmAgeCode();
+  assertFalse(%IsWasmFunctionCompiled(exports.cold));
+  assertFalse(%IsWasmFunctionCompiled(exports.call_cold));
+  // Evicted functions are recompiled on their next call, both when called
+  // from JavaScript and from other wasm functions.
+  assertEquals(5, exports.call_cold(3));
+  assertTrue(%IsWasmFunctionCompiled(exports.call_cold));
+  assertTrue(%IsWasmFunctionCompiled(exports.cold));
+  assertEquals(7, exports.cold(5));
+})();
+
+(function callResetsAge() {
+  print(arguments.callee.name);
+  const exports = instantiate().exports;
+  %WasmAgeCode();
+  // The first call after aging reactivates the code instead of compiling it.
+  assertEquals(4, exports.call_cold(2));
+  %WasmAgeCode();
+  assertTrue(%IsWasmFunctionCompiled(exports.cold));
+  assertTrue(%IsWasmFunctionCompiled(exports.call_cold));
+  %WasmAgeCode();
+  assertFalse(%IsWasmFunctionCompiled(exports.cold));
+  assertFalse(%IsWasmFunctionCompiled(exports.call_cold));
+})();
@@ -0,0 +1,66 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --wasm-lazy-js-to-wasm-wrappers --allow-natives-syntax
+
+load('test/mjsunit/wasm/wasm-module-builder.js');
+
+function buildModule() {
+  const builder = new WasmModuleBuilder();
+  builder.addFunction('add', kSig_i_ii)
+      .addBody([kExprGetLocal, 0, kExprGetLocal, 1, kExprI32Add])
+      .exportFunc();
+  builder.addFunction('sub', kSig_i_ii)
+      .addBody([kExprGetLocal, 0, kExprGetLocal, 1, kExprI32Sub])
+      .exportFunc();
+  builder.addFunction('half', kSig_d_d)
+      .addBody([kExprGetLocal, 0, ...wasmF64Const(2), kExprF64Div])
+      .exportFunc();
+  return builder.toModule();
+}
+
+(function callExports() {
+  print(arguments.callee.name);
+  const instance = new WebAssembly.Instance(buildModule());
+  assertTrue(%IsWasmCode(instance.exports.add));
+  assertEquals(5, instance.exports.add(2, 3));
+  assertEquals(5, instance.exports.add(2, 3));
+  assertTrue(%IsWasmCode(instance.exports.add));
+  // {sub} shares the signature (and therefore the wrapper) with {add}.
+  assertEquals(-1, instance.exports.sub(2, 3));
+  assertEquals(1.5, instance.exports.half(3));
+})();
+
+(function argumentCountMismatch() {
+  print(arguments.callee.name);
+  const instance = new WebAssembly.Instance(buildModule());
+  assertEquals(2, instance.exports.add(2));
+  assertEquals(3, instance.exports.add(1, 2, 3));
+  assertEquals(NaN, instance.exports.half());
+})();
+
+(function wrapperSharedAcrossInstances() {
+  print(arguments.callee.name);
+  const module = buildModule();
+  const instance1 = new WebAssembly.Instance(module);
+  const instance2 = new WebAssembly.Instance(module);
+  assertEquals(7, instance1.exports.add(3, 4));
+  assertEquals(9, instance2.exports.add(4, 5));
+  assertEquals(-2, instance2.exports.sub(3, 5));
+})();
+
+(function importUncalledExport() {
+  print(arguments.callee.name);
+  // An export whose wrapper was not compiled yet is still recognized as a
+  // wasm function when imported into another module.
+  const instance1 = new WebAssembly.Instance(buildModule());
+  const builder = new WasmModuleBuilder();
+  const add_index = builder.addImport('mod', 'add', kSig_i_ii);
+  builder.addFunction('main', kSig_i_v)
+      .addBody([kExprI32Const, 20, kExprI32Const, 22,
+                kExprCallFunction, add_index])
+      .exportFunc();
+  const instance2 = builder.instantiate({mod: {add: instance1.exports.add}});
+  assertEquals(42, instance2.exports.main());
+})();
@@ -111,6 +111,7 @@ class MockPlatform : public v8::Platform {
   MockPlatform()
       : time_(0.0),
         time_step_(0.0),
+        idle_tasks_enabled_(true),
         idle_task_(nullptr),
         sem_(0),
         tracing_controller_(V8::GetCurrentPlatform()->GetTracingController()) {}
@@ -155,7 +156,13 @@ class MockPlatform : public v8::Platform {
     idle_task_ = task;
   }
 
-  bool IdleTasksEnabled(v8::Isolate* isolate) override { return true; }
+  bool IdleTasksEnabled(v8::Isolate* isolate) override {
+    return idle_tasks_enabled_;
+  }
+
+  void set_idle_tasks_enabled(bool enabled) { idle_tasks_enabled_ = enabled; }
+
+  void set_time_step(double time_step) { time_step_ = time_step; }
 
   double MonotonicallyIncreasingTime() override {
     time_ += time_step_;
@@ -302,7 +309,7 @@ class MockPlatform : public v8::Platform {
       platform_->idle_task_ = task.release();
     }
 
-    bool IdleTasksEnabled() override { return true; }
+    bool IdleTasksEnabled() override { return platform_->idle_tasks_enabled_; }
 
    private:
     MockPlatform* platform_;
@@ -310,6 +317,7 @@ class MockPlatform : public v8::Platform {
 
   double time_;
   double time_step_;
+  bool idle_tasks_enabled_;
 
   // Protects all *_tasks_.
   base::Mutex mutex_;
@@ -848,5 +856,77 @@ TEST_F(CompilerDispatcherTest, CompileMultipleOnBackgroundThread) {
   dispatcher.AbortAll();
 }
 
+TEST_F(CompilerDispatcherTest, NoFinalizationWithoutIdleTasks) {
+  MockPlatform platform;
+  platform.set_idle_tasks_enabled(false);
+  CompilerDispatcher dispatcher(i_isolate(), &platform, FLAG_stack_size);
+
+  Handle<SharedFunctionInfo> shared =
+      test::CreateSharedFunctionInfo(i_isolate(), nullptr);
+  base::Optional<CompilerDispatcher::JobId> job_id =
+      EnqueueUnoptimizedCompileJob(&dispatcher, i_isolate(), shared);
+  dispatcher.RegisterSharedFunctionInfo(*job_id, *shared);
+
+  platform.RunWorkerTasksAndBlock(V8::GetCurrentPlatform());
+
+  // Without --parallel-compile-tasks-for-lazy, finished jobs are left for
+  // FinishNow instead of being finalized from regular foreground tasks.
+  ASSERT_FALSE(platform.IdleTaskPending());
+  ASSERT_FALSE(platform.ForegroundTasksPending());
+  ASSERT_TRUE(dispatcher.IsEnqueued(shared));
+
+  ASSERT_TRUE(dispatcher.FinishNow(shared));
+  ASSERT_FALSE(dispatcher.IsEnqueued(shared));
+  ASSERT_TRUE(shared->is_compiled());
+  dispatcher.AbortAll();
+}
+
+TEST_F(CompilerDispatcherTest, FinalizeInBatchesWithoutIdleTasks) {
+  MockPlatform platform;
+  platform.set_idle_tasks_enabled(false);
+  // The dispatcher reads the flag on construction.
+  bool saved_flag = FLAG_parallel_compile_tasks_for_lazy;
+  FLAG_parallel_compile_tasks_for_lazy = true;
+  CompilerDispatcher dispatcher(i_isolate(), &platform, FLAG_stack_size);
+  FLAG_parallel_compile_tasks_for_lazy = saved_flag;
+
+  Handle<SharedFunctionInfo> shared_1 =
+      test::CreateSharedFunctionInfo(i_isolate(), nullptr);
+  Handle<SharedFunctionInfo> shared_2 =
+      test::CreateSharedFunctionInfo(i_isolate(), nullptr);
+
+  base::Optional<CompilerDispatcher::JobId> job_id_1 =
+      EnqueueUnoptimizedCompileJob(&dispatcher, i_isolate(), shared_1);
+  dispatcher.RegisterSharedFunctionInfo(*job_id_1, *shared_1);
+  base::Optional<CompilerDispatcher::JobId> job_id_2 =
+      EnqueueUnoptimizedCompileJob(&dispatcher, i_isolate(), shared_2);
+  dispatcher.RegisterSharedFunctionInfo(*job_id_2, *shared_2);
+
+  platform.RunWorkerTasksAndBlock(V8::GetCurrentPlatform());
+
+  // Finished jobs are finalized from a regular foreground task.
+  ASSERT_FALSE(platform.IdleTaskPending());
+  ASSERT_TRUE(platform.ForegroundTasksPending());
+  ASSERT_EQ(dispatcher.jobs_.size(), 2u);
+
+  // Have time advance beyond the batch budget after every step, so that only
+  // one job is finalized per task.
+  platform.set_time_step(
+      CompilerDispatcher::kFinalizationBatchTimeInSeconds * 0.75);
+  platform.RunForegroundTasks();
+  ASSERT_EQ(dispatcher.jobs_.size(), 1u);
+  ASSERT_TRUE(platform.ForegroundTasksPending());
+
+  // With time frozen, the next batch finalizes the remaining job.
+  platform.set_time_step(0.0);
+  platform.RunForegroundTasks();
+  ASSERT_FALSE(dispatcher.IsEnqueued(shared_1));
+  ASSERT_FALSE(dispatcher.IsEnqueued(shared_2));
+  ASSERT_TRUE(shared_1->is_compiled());
+  ASSERT_TRUE(shared_2->is_compiled());
+  ASSERT_FALSE(platform.ForegroundTasksPending());
+  dispatcher.AbortAll();
+}
+
 }  // namespace internal
 }  // namespace v8
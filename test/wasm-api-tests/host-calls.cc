@@ -0,0 +1,98 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "test/wasm-api-tests/wasm-api-test.h"
+
+#include "src/base/platform/elapsed-timer.h"
+
+namespace v8 {
+namespace internal {
+namespace wasm {
+
+namespace {
+
+own<Trap*> Decrement(void* env, const Val args[], Val results[]) {
+  int* call_count = reinterpret_cast<int*>(env);
+  ++*call_count;
+  results[0] = Val::i32(args[0].i32() - 1);
+  return nullptr;
+}
+
+own<Trap*> Double(void* env, const Val args[], Val results[]) {
+  int* call_count = reinterpret_cast<int*>(env);
+  ++*call_count;
+  results[0] = Val::i32(args[0].i32() * 2);
+  return nullptr;
+}
+
+}  // namespace
+
+TEST_F(WasmCapiTest, HostCallsSharingASignature) {
+  // Two different host functions with the same signature share a single
+  // wasm-to-C-API wrapper; make sure each import still reaches its own
+  // callback.
+  // int32 func(int32 arg0) { return double(decrement(arg0)); }
+  uint32_t decrement_index =
+      builder()->AddImport(ArrayVector("decrement"), wasm_i_i_sig());
+  uint32_t double_index =
+      builder()->AddImport(ArrayVector("double"), wasm_i_i_sig());
+  byte code[] = {WASM_CALL_FUNCTION(
+      double_index, WASM_CALL_FUNCTION(decrement_index, WASM_GET_LOCAL(0)))};
+  AddExportedFunction(CStrVector("func"), code, sizeof(code), wasm_i_i_sig());
+
+  int decrement_calls = 0;
+  int double_calls = 0;
+  own<Func*> decrement =
+      Func::make(store(), cpp_i_i_sig(), Decrement, &decrement_calls);
+  own<Func*> twice = Func::make(store(), cpp_i_i_sig(), Double, &double_calls);
+  Extern* imports[] = {decrement.get(), twice.get()};
+  Instantiate(imports);
+  Val args[] = {Val::i32(22)};
+  Val results[1];
+  own<Trap*> trap = GetExportedFunction(0)->call(args, results);
+  EXPECT_EQ(nullptr, trap);
+  EXPECT_EQ(42, results[0].i32());
+  EXPECT_EQ(1, decrement_calls);
+  EXPECT_EQ(1, double_calls);
+}
+
+TEST_F(WasmCapiTest, HostCallLoop) {
+  // Calls into the host {arg0} times from a tight wasm loop and reports the
+  // average cost of a single host call.
+  // int32 func(int32 arg0) {
+  //   while (arg0) arg0 = decrement(arg0);
+  //   return arg0;
+  // }
+  uint32_t decrement_index =
+      builder()->AddImport(ArrayVector("decrement"), wasm_i_i_sig());
+  byte code[] = {
+      WASM_WHILE(WASM_GET_LOCAL(0),
+                 WASM_SET_LOCAL(0, WASM_CALL_FUNCTION(decrement_index,
+                                                      WASM_GET_LOCAL(0)))),
+      WASM_GET_LOCAL(0)};
+  AddExportedFunction(CStrVector("func"), code, sizeof(code), wasm_i_i_sig());
+
+  int call_count = 0;
+  own<Func*> decrement =
+      Func::make(store(), cpp_i_i_sig(), Decrement, &call_count);
+  Extern* imports[] = {decrement.get()};
+  Instantiate(imports);
+
+  const int kIterations = 1000000;
+  Val args[] = {Val::i32(kIterations)};
+  Val results[1];
+  base::ElapsedTimer timer;
+  timer.Start();
+  own<Trap*> trap = GetExportedFunction(0)->call(args, results);
+  double elapsed_ns = timer.Elapsed().InMicroseconds() * 1000.0;
+  EXPECT_EQ(nullptr, trap);
+  EXPECT_EQ(0, results[0].i32());
+  EXPECT_EQ(kIterations, call_count);
+  printf("HostCallLoop: %d calls, %.1f ns/call\n", kIterations,
+         elapsed_ns / kIterations);
+}
+
+}  // namespace wasm
+}  // namespace internal
+}  // namespace v8
@@ -193,6 +193,7 @@ const CATEGORIES = new Map([
       'SOURCE_POSITION_TABLE_TYPE',
       'STORE_HANDLER_TYPE',
       'STUB',
+      'TRIMMED_SOURCE_POSITION_TABLE_TYPE',
       'UNCOMPILED_DATA_WITHOUT_PREPARSE_DATA_TYPE',
       'UNCOMPILED_DATA_WITH_PREPARSE_DATA_TYPE',
       'UNCOMPILED_JS_FUNCTION_TYPE',